@@ -71,6 +71,73 @@ void goblin_accumulate(State& state) noexcept
     }
 }
 
+/**
+ * @brief Like goblin_accumulate, but each kernel is preceded by an app circuit whose witness is generated while the
+ * previous kernel is proven in the background
+ */
+void goblin_accumulate_pipelined(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    bb::srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
+
+    Goblin goblin;
+
+    // Construct an initial circuit; its proof will be recursively verified by the first kernel
+    GoblinUltraCircuitBuilder initial_circuit{ goblin.op_queue };
+    GoblinMockCircuits::construct_simple_initial_circuit(initial_circuit);
+    auto kernel_output = goblin.accumulate_async(std::move(initial_circuit));
+
+    size_t NUM_CIRCUITS = 1 << static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        std::vector<std::future<Goblin::AccumulationOutput>> app_outputs;
+        for (size_t circuit_idx = 0; circuit_idx < NUM_CIRCUITS; ++circuit_idx) {
+            GoblinUltraCircuitBuilder app_circuit{ goblin.op_queue };
+            GoblinMockCircuits::construct_arithmetic_circuit(app_circuit, /*num_gates=*/1 << 10);
+            GoblinMockCircuits::construct_goblin_ecc_op_circuit(app_circuit);
+            app_outputs.emplace_back(goblin.accumulate_async(std::move(app_circuit)));
+
+            // Construct a circuit with logic resembling that of the "kernel circuit"
+            Goblin::AccumulationOutput kernel_input = kernel_output.get();
+            GoblinUltraCircuitBuilder circuit_builder{ goblin.op_queue };
+            GoblinMockCircuits::construct_mock_kernel_circuit(circuit_builder, kernel_input);
+            kernel_output = goblin.accumulate_async(std::move(circuit_builder));
+        }
+        // Wait for the last kernel; the app proofs before it have completed by then
+        kernel_output.wait();
+    }
+}
+
+/**
+ * @brief The same app and kernel sequence as goblin_accumulate_pipelined, accumulated synchronously
+ */
+void goblin_accumulate_sequential(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    bb::srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
+
+    Goblin goblin;
+
+    // Construct an initial circuit; its proof will be recursively verified by the first kernel
+    GoblinUltraCircuitBuilder initial_circuit{ goblin.op_queue };
+    GoblinMockCircuits::construct_simple_initial_circuit(initial_circuit);
+    Goblin::AccumulationOutput kernel_input = goblin.accumulate(initial_circuit);
+
+    size_t NUM_CIRCUITS = 1 << static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        for (size_t circuit_idx = 0; circuit_idx < NUM_CIRCUITS; ++circuit_idx) {
+            GoblinUltraCircuitBuilder app_circuit{ goblin.op_queue };
+            GoblinMockCircuits::construct_arithmetic_circuit(app_circuit, /*num_gates=*/1 << 10);
+            GoblinMockCircuits::construct_goblin_ecc_op_circuit(app_circuit);
+            goblin.accumulate(app_circuit);
+
+            // Construct a circuit with logic resembling that of the "kernel circuit"
+            GoblinUltraCircuitBuilder circuit_builder{ goblin.op_queue };
+            GoblinMockCircuits::construct_mock_kernel_circuit(circuit_builder, kernel_input);
+            kernel_input = goblin.accumulate(circuit_builder);
+        }
+    }
+}
+
 void goblin_eccvm_prove(State& state) noexcept
 {
     bb::srs::init_crs_factory("../srs_db/ignition");
@@ -132,5 +199,7 @@ void goblin_translator_prove(State& state) noexcept
 
 BENCHMARK(goblin_full)->Unit(kMillisecond)->DenseRange(0, 7);
 BENCHMARK(goblin_accumulate)->Unit(kMillisecond)->DenseRange(0, 7);
+BENCHMARK(goblin_accumulate_pipelined)->Unit(kMillisecond)->DenseRange(0, 7);
+BENCHMARK(goblin_accumulate_sequential)->Unit(kMillisecond)->DenseRange(0, 7);
 BENCHMARK(goblin_eccvm_prove)->Unit(kMillisecond)->DenseRange(0, 7);
 BENCHMARK(goblin_translator_prove)->Unit(kMillisecond)->DenseRange(0, 7);
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "barretenberg/flavor/goblin_ultra.hpp"
+#include "barretenberg/flavor/ultra.hpp"
+#include <benchmark/benchmark.h>
+#include <utility>
+
+using namespace benchmark;
+
+namespace bb::benchmark::flavor_views {
+
+constexpr size_t NUM_ROWS = 1 << 10;
+
+template <typename Flavor> typename Flavor::ProverPolynomials get_random_polynomials()
+{
+    using FF = typename Flavor::FF;
+    typename Flavor::ProverPolynomials polynomials;
+    for (auto& polynomial : polynomials.get_all()) {
+        polynomial = typename Flavor::Polynomial(NUM_ROWS);
+        for (size_t i = 0; i < NUM_ROWS; ++i) {
+            polynomial[i] = FF::random_element();
+        }
+    }
+    return polynomials;
+}
+
+/**
+ * @brief Getting the fixed-size view of all the prover polynomials
+ */
+template <typename Flavor> void get_all(State& state) noexcept
+{
+    auto polynomials = get_random_polynomials<Flavor>();
+    for (auto _ : state) {
+        DoNotOptimize(polynomials.get_all());
+    }
+}
+BENCHMARK_TEMPLATE(get_all, honk::flavor::Ultra);
+BENCHMARK_TEMPLATE(get_all, honk::flavor::GoblinUltra);
+
+/**
+ * @brief Getting the view of all the prover polynomials as a heap-allocated RefVector, as get_all() used to
+ */
+template <typename Flavor> void get_all_as_ref_vector(State& state) noexcept
+{
+    using Polynomial = typename Flavor::Polynomial;
+    auto polynomials = get_random_polynomials<Flavor>();
+    for (auto _ : state) {
+        DoNotOptimize(RefVector<Polynomial>(polynomials.get_all()));
+    }
+}
+BENCHMARK_TEMPLATE(get_all_as_ref_vector, honk::flavor::Ultra);
+BENCHMARK_TEMPLATE(get_all_as_ref_vector, honk::flavor::GoblinUltra);
+
+/**
+ * @brief Reading every row of the prover polynomials
+ */
+template <typename Flavor> void get_row(State& state) noexcept
+{
+    auto polynomials = get_random_polynomials<Flavor>();
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_ROWS; ++i) {
+            DoNotOptimize(polynomials.get_row(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_ROWS));
+}
+BENCHMARK_TEMPLATE(get_row, honk::flavor::Ultra);
+BENCHMARK_TEMPLATE(get_row, honk::flavor::GoblinUltra);
+
+/**
+ * @brief Reading every row of the prover polynomials through RefVector views, as get_row() used to
+ */
+template <typename Flavor> void get_row_through_ref_vectors(State& state) noexcept
+{
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+    auto polynomials = get_random_polynomials<Flavor>();
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_ROWS; ++i) {
+            typename Flavor::AllValues row;
+            RefVector<FF> values(row.get_all());
+            RefVector<const Polynomial> columns(std::as_const(polynomials).get_all());
+            for (auto [value, polynomial] : zip_view(values, columns)) {
+                value = polynomial[i];
+            }
+            DoNotOptimize(row);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_ROWS));
+}
+BENCHMARK_TEMPLATE(get_row_through_ref_vectors, honk::flavor::Ultra);
+BENCHMARK_TEMPLATE(get_row_through_ref_vectors, honk::flavor::GoblinUltra);
+
+} // namespace bb::benchmark::flavor_views
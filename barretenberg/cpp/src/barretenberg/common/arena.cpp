@@ -0,0 +1,98 @@
+#include "arena.hpp"
+#include "barretenberg/common/mem.hpp"
+#include <algorithm>
+#if defined(__linux__) && !defined(__wasm__)
+#include <sys/mman.h>
+#endif
+
+namespace bb {
+
+namespace {
+size_t round_up(size_t size, size_t multiple)
+{
+    return (size + multiple - 1) / multiple * multiple;
+}
+} // namespace
+
+Arena::Arena(size_t chunk_size)
+    : chunk_size_(round_up(chunk_size, HUGE_PAGE_SIZE))
+{}
+
+Arena::~Arena()
+{
+    for (auto& chunk : chunks_) {
+        aligned_free(chunk.data);
+    }
+}
+
+void* Arena::allocate(size_t size)
+{
+    size = round_up(size == 0 ? 1 : size, ALIGNMENT);
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif
+    // Allocations are served in order, so a build repeating the allocations of the previous one fits in the same chunks
+    for (; current_chunk_ < chunks_.size(); ++current_chunk_) {
+        auto& chunk = chunks_[current_chunk_];
+        if (chunk.size - chunk.used >= size) {
+            void* result = chunk.data + chunk.used;
+            chunk.used += size;
+            return result;
+        }
+    }
+
+    const size_t chunk_size = std::max(chunk_size_, round_up(size, HUGE_PAGE_SIZE));
+    auto* data = static_cast<uint8_t*>(aligned_alloc(HUGE_PAGE_SIZE, chunk_size));
+#if defined(__linux__) && !defined(__wasm__)
+    // Only a hint: without transparent huge pages the chunk is simply backed by regular pages
+    madvise(data, chunk_size, MADV_HUGEPAGE);
+#endif
+    chunks_.push_back(Chunk{ data, chunk_size, size });
+    current_chunk_ = chunks_.size() - 1;
+    return data;
+}
+
+void Arena::reset()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif
+    for (auto& chunk : chunks_) {
+        chunk.used = 0;
+    }
+    current_chunk_ = 0;
+}
+
+size_t Arena::get_used_size() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif
+    size_t used = 0;
+    for (const auto& chunk : chunks_) {
+        used += chunk.used;
+    }
+    return used;
+}
+
+size_t Arena::get_capacity() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif
+    size_t capacity = 0;
+    for (const auto& chunk : chunks_) {
+        capacity += chunk.size;
+    }
+    return capacity;
+}
+
+size_t Arena::get_num_chunks() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif
+    return chunks_.size();
+}
+
+} // namespace bb
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace bb {
+
+/**
+ * A chunked bump allocator, for memory that is all released at once, such as the vectors of a circuit builder.
+ *
+ * Memory is handed out from chunks of at least `chunk_size` bytes, aligned to huge pages and, on Linux, advised to be
+ * backed by them. Nothing is freed before reset(), which keeps the chunks for the next round of allocations: a circuit
+ * built again on a reset arena writes to the pages the previous build faulted in, instead of asking the system for new
+ * ones. Deallocation is a no-op, so a vector growing in the arena leaves its old buffers behind until the next reset;
+ * reserve upfront where the final sizes are known.
+ *
+ * Allocation takes a lock, as containers in the arena may grow on several threads at once.
+ */
+class Arena {
+  public:
+    static constexpr size_t HUGE_PAGE_SIZE = 2UL << 20;
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 8 * HUGE_PAGE_SIZE;
+    static constexpr size_t ALIGNMENT = 64;
+
+    explicit Arena(size_t chunk_size = DEFAULT_CHUNK_SIZE);
+    Arena(const Arena& other) = delete;
+    Arena(Arena&& other) = delete;
+    Arena& operator=(const Arena& other) = delete;
+    Arena& operator=(Arena&& other) = delete;
+    ~Arena();
+
+    void* allocate(size_t size);
+
+    /**
+     * Releases everything allocated so far, keeping the chunks. Memory allocated before the reset must no longer be in
+     * use.
+     */
+    void reset();
+
+    // The number of bytes allocated since the last reset
+    size_t get_used_size() const;
+    // The number of bytes held in chunks
+    size_t get_capacity() const;
+    size_t get_num_chunks() const;
+
+  private:
+    struct Chunk {
+        uint8_t* data;
+        size_t size;
+        size_t used;
+    };
+
+    size_t chunk_size_;
+    std::vector<Chunk> chunks_;
+    // The chunk allocations are served from; the ones before it are full
+    size_t current_chunk_ = 0;
+#ifndef NO_MULTITHREADING
+    mutable std::mutex mutex_;
+#endif
+};
+
+} // namespace bb
@@ -1,9 +1,11 @@
+#pragma once
 #include "barretenberg/common/assert.hpp"
 #include <array>
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
+#include <vector>
 
 namespace bb {
 /**
@@ -21,15 +23,15 @@ template <typename T, std::size_t N> class RefArray {
     RefArray(const std::array<T*, N>& ptr_array)
     {
         std::size_t i = 0;
-        for (T& elem : ptr_array) {
-            storage[i++] = &elem;
+        for (T* elem : ptr_array) {
+            storage[i++] = elem;
         }
     }
-    template <typename... Ts> RefArray(T& ref, Ts&... rest)
+    template <typename... Ts>
+    RefArray(T& ref, Ts&... rest)
+        : storage{ &ref, &rest... }
     {
-        storage[0] = &ref;
-        int i = 1;
-        ((storage[i++] = &rest), ...);
+        static_assert(1 + sizeof...(Ts) == N, "RefArray must be given exactly N references");
     }
 
     T& operator[](std::size_t idx) const
@@ -92,6 +94,15 @@ template <typename T, std::size_t N> class RefArray {
      */
     iterator end() const { return iterator(this, N); }
 
+    template <typename ConvertibleFromT> operator std::vector<ConvertibleFromT>() const
+    {
+        std::vector<ConvertibleFromT> ret;
+        for (T* elem : storage) {
+            ret.push_back(*elem);
+        }
+        return ret;
+    }
+
   private:
     // We are making a high-level array, for simplicity having a C array as backing makes sense.
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/ref_array.hpp"
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
@@ -32,6 +33,18 @@ template <typename T> class RefVector {
         }
     }
 
+    /**
+     * @brief Copy the pointers of a RefArray, for code that takes a RefVector of any size
+     */
+    template <std::size_t N>
+    RefVector(const RefArray<T, N>& ref_array) // NOLINT(google-explicit-constructor)
+        : storage(N)
+    {
+        for (std::size_t i = 0; i < N; i++) {
+            storage[i] = &ref_array[i];
+        }
+    }
+
     template <typename... Ts> RefVector(T& ref, Ts&... rest)
     {
         storage.push_back(&ref);
@@ -128,8 +141,11 @@ template <typename T> RefVector<T> concatenate(const RefVector<T>& ref_vector, c
     // Reserve our final space
     concatenated.get_storage().reserve(ref_vector.size() + (ref_vectors.size() + ...));
 
+    // Takes RefArrays as well as RefVectors
     auto append = [&](const auto& vec) {
-        std::copy(vec.get_storage().begin(), vec.get_storage().end(), std::back_inserter(concatenated.get_storage()));
+        for (T& element : vec) {
+            concatenated.get_storage().push_back(&element);
+        }
     };
 
     append(ref_vector);
@@ -1,9 +1,11 @@
 #pragma once
+#include "./arena.hpp"
 #include "./assert.hpp"
 #include "./log.hpp"
 #include <list>
 #include <map>
 #include <memory>
+#include <type_traits>
 #include <unordered_map>
 #ifndef NO_MULTITHREADING
 #include <mutex>
@@ -43,6 +45,10 @@ void free_mem_slab_raw(void*);
 
 /**
  * Allocator for containers such as std::vector. Makes them leverage the underlying slab allocator where possible.
+ *
+ * An allocator constructed with an Arena allocates from the arena instead, and frees nothing. The arena moves with the
+ * container, but a copy of the container is allocated from the slab allocator, so that it does not depend on the
+ * lifetime of the arena.
  */
 template <typename T> class ContainerSlabAllocator {
   public:
@@ -50,29 +56,55 @@ template <typename T> class ContainerSlabAllocator {
     using pointer = T*;
     using const_pointer = const T*;
     using size_type = std::size_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
 
     template <typename U> struct rebind {
         using other = ContainerSlabAllocator<U>;
     };
 
+    ContainerSlabAllocator() = default;
+    explicit ContainerSlabAllocator(Arena* arena)
+        : arena_(arena)
+    {}
+    template <typename U>
+    ContainerSlabAllocator(const ContainerSlabAllocator<U>& other) // NOLINT(google-explicit-constructor)
+        : arena_(other.get_arena())
+    {}
+
     pointer allocate(size_type n)
     {
         // info("ContainerSlabAllocator allocating: ", n * sizeof(T));
+        if (arena_ != nullptr) {
+            return static_cast<pointer>(arena_->allocate(n * sizeof(T)));
+        }
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         return reinterpret_cast<pointer>(get_mem_slab_raw(n * sizeof(T)));
     }
 
-    void deallocate(pointer p, size_type /*unused*/) { free_mem_slab_raw(p); }
+    void deallocate(pointer p, size_type /*unused*/)
+    {
+        if (arena_ == nullptr) {
+            free_mem_slab_raw(p);
+        }
+    }
 
-    friend bool operator==(const ContainerSlabAllocator<T>& /*unused*/, const ContainerSlabAllocator<T>& /*unused*/)
+    ContainerSlabAllocator select_on_container_copy_construction() const { return ContainerSlabAllocator(); }
+
+    Arena* get_arena() const { return arena_; }
+
+    friend bool operator==(const ContainerSlabAllocator<T>& lhs, const ContainerSlabAllocator<T>& rhs)
     {
-        return true;
+        return lhs.arena_ == rhs.arena_;
     }
 
-    friend bool operator!=(const ContainerSlabAllocator<T>& /*unused*/, const ContainerSlabAllocator<T>& /*unused*/)
+    friend bool operator!=(const ContainerSlabAllocator<T>& lhs, const ContainerSlabAllocator<T>& rhs)
     {
-        return false;
+        return lhs.arena_ != rhs.arena_;
     }
+
+  private:
+    Arena* arena_ = nullptr;
 };
 
 } // namespace bb
\ No newline at end of file
@@ -73,4 +73,11 @@ int blake2s_final(blake2s_state* S, void* out, size_t outlen);
 
 std::array<uint8_t, BLAKE2S_OUTBYTES> blake2s(std::vector<uint8_t> const& input);
 
+/**
+ * @brief Blake2s of many independent messages; equivalent to calling blake2s on each
+ * @details On x86_64, messages with the same number of blocks are hashed 16 (AVX-512) or 8 (AVX2) at a time across the
+ * lanes of vector registers, when the CPU supports it. The rest go through the scalar implementation.
+ */
+std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>> blake2s_many(const std::vector<std::vector<uint8_t>>& inputs);
+
 } // namespace bb::crypto
\ No newline at end of file
@@ -386,4 +386,28 @@ TEST(misc_blake2s, test_vectors)
         std::vector<uint8_t> input(v.input.begin(), v.input.end());
         EXPECT_EQ(crypto::blake2s(input), v.output);
     }
-}
\ No newline at end of file
+}
+
+TEST(misc_blake2s, blake2s_many_matches_blake2s)
+{
+    // Enough messages of each length to fill whole lane groups, plus leftovers, including empty and whole-block
+    // messages
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t length = 0; length < 200; ++length) {
+        const size_t num_messages = length % 8 == 0 ? 35 : 1;
+        for (size_t i = 0; i < num_messages; ++i) {
+            std::vector<uint8_t> input(length);
+            for (size_t j = 0; j < length; ++j) {
+                input[j] = static_cast<uint8_t>(i * 31 + j * 7 + length);
+            }
+            inputs.push_back(input);
+        }
+    }
+
+    auto results = crypto::blake2s_many(inputs);
+
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], crypto::blake2s(inputs[i]));
+    }
+}
@@ -0,0 +1,242 @@
+#include "blake2s.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#define BLAKE2S_X86_KERNELS 1
+#endif
+
+namespace bb::crypto {
+
+namespace {
+
+#ifdef BLAKE2S_X86_KERNELS
+
+/**
+ * @brief A message as a sequence of blocks: its whole blocks in place, then the final block zero-padded in a copy
+ */
+struct MessageBlocks {
+    const uint8_t* data = nullptr;
+    size_t num_full_blocks = 0;
+    uint8_t tail[BLAKE2S_BLOCKBYTES];
+
+    // The final block is compressed with the finalization flag set even when it is whole, and the empty message is
+    // compressed once, as a block of zeroes
+    static size_t get_num_blocks(const size_t size)
+    {
+        return std::max<size_t>(1, (size + BLAKE2S_BLOCKBYTES - 1) / BLAKE2S_BLOCKBYTES);
+    }
+
+    void init(const std::vector<uint8_t>& input)
+    {
+        data = input.data();
+        num_full_blocks = get_num_blocks(input.size()) - 1;
+        const size_t remainder = input.size() - num_full_blocks * BLAKE2S_BLOCKBYTES;
+        std::fill(std::begin(tail), std::end(tail), 0);
+        std::copy(input.end() - static_cast<std::ptrdiff_t>(remainder), input.end(), tail);
+    }
+
+    const uint8_t* block(const size_t i) const { return i < num_full_blocks ? data + i * BLAKE2S_BLOCKBYTES : tail; }
+};
+
+constexpr uint32_t blake2s_IV[8] = { 0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
+                                     0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL };
+
+constexpr uint8_t blake2s_sigma[10][16] = {
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }, { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+    { 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 }, { 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+    { 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 }, { 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+    { 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 }, { 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+    { 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 }, { 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+};
+
+// The (a, b, c, d) state indices of the eight G applications of a round: the columns, then the diagonals
+constexpr size_t g_indices[8][4] = { { 0, 4, 8, 12 }, { 1, 5, 9, 13 }, { 2, 6, 10, 14 }, { 3, 7, 11, 15 },
+                                     { 0, 5, 10, 15 }, { 1, 6, 11, 12 }, { 2, 7, 8, 13 }, { 3, 4, 9, 14 } };
+
+// The generic lane kernels below return vectors by value, but are always inlined into the target-specific functions
+// calling them, so GCC's warning about the ABI of such returns does not apply
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+using u32x16 = uint32_t __attribute__((vector_size(64)));
+using u32x8 = uint32_t __attribute__((vector_size(32)));
+
+template <uint32_t shift, typename V> [[gnu::always_inline]] inline V ror(const V& val)
+{
+    return (val >> shift) | (val << (32 - shift));
+}
+
+/**
+ * @brief Blake2s compression of one block of each of the messages in the lanes of V
+ * @param counter_low, counter_high the per-lane byte counter t
+ * @param last_block the per-lane finalization flag f[0]
+ */
+template <typename V>
+[[gnu::always_inline]] inline void compress_lanes(
+    V* h, const V* m, const V& counter_low, const V& counter_high, const V& last_block)
+{
+    V v[16];
+#pragma GCC unroll 8
+    for (size_t i = 0; i < 8; ++i) {
+        v[i] = h[i];
+        v[i + 8] = V{} + blake2s_IV[i];
+    }
+    v[12] ^= counter_low;
+    v[13] ^= counter_high;
+    v[14] ^= last_block;
+
+#pragma GCC unroll 10
+    for (size_t r = 0; r < 10; ++r) {
+#pragma GCC unroll 8
+        for (size_t i = 0; i < 8; ++i) {
+            V& a = v[g_indices[i][0]];
+            V& b = v[g_indices[i][1]];
+            V& c = v[g_indices[i][2]];
+            V& d = v[g_indices[i][3]];
+            a = a + b + m[blake2s_sigma[r][2 * i]];
+            d = ror<16>(d ^ a);
+            c = c + d;
+            b = ror<12>(b ^ c);
+            a = a + b + m[blake2s_sigma[r][2 * i + 1]];
+            d = ror<8>(d ^ a);
+            c = c + d;
+            b = ror<7>(b ^ c);
+        }
+    }
+
+#pragma GCC unroll 8
+    for (size_t i = 0; i < 8; ++i) {
+        h[i] ^= v[i] ^ v[i + 8];
+    }
+}
+
+/**
+ * @brief Hash LANES messages with the same number of blocks, one per lane of V
+ */
+template <typename V, size_t LANES>
+[[gnu::always_inline]] inline void hash_lanes(const std::vector<uint8_t>* const* messages,
+                                              const size_t num_blocks,
+                                              std::array<uint8_t, BLAKE2S_OUTBYTES>* outputs)
+{
+    MessageBlocks lane_messages[LANES];
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        lane_messages[lane].init(*messages[lane]);
+    }
+    V h[8];
+    for (size_t i = 0; i < 8; ++i) {
+        h[i] = V{} + blake2s_IV[i];
+    }
+    // Parameter block: 32-byte digest, no key, fanout and depth 1
+    h[0] ^= 0x01010000U ^ BLAKE2S_OUTBYTES;
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const bool is_last = block + 1 == num_blocks;
+        // Transpose the block words through memory, so that each becomes a single vector load; x86 is little-endian,
+        // so the words load as they are
+        V m[16];
+        V counter_low = {};
+        V counter_high = {};
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            for (size_t j = 0; j < 16; ++j) {
+                std::memcpy(reinterpret_cast<uint32_t*>(&m[j]) + lane,
+                            lane_messages[lane].block(block) + j * 4,
+                            sizeof(uint32_t));
+            }
+            // The byte counter t covers the message up to the end of this block
+            const uint64_t counter = is_last ? messages[lane]->size() : (block + 1) * BLAKE2S_BLOCKBYTES;
+            counter_low[lane] = static_cast<uint32_t>(counter);
+            counter_high[lane] = static_cast<uint32_t>(counter >> 32);
+        }
+        compress_lanes(h, m, counter_low, counter_high, V{} + (is_last ? 0xFFFFFFFFU : 0U));
+    }
+
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        for (size_t i = 0; i < 8; ++i) {
+            const uint32_t word = h[i][lane];
+            std::memcpy(&outputs[lane][i * 4], &word, sizeof(word));
+        }
+    }
+}
+
+__attribute__((target("avx512f"))) void hash_lanes_avx512(const std::vector<uint8_t>* const* messages,
+                                                          const size_t num_blocks,
+                                                          std::array<uint8_t, BLAKE2S_OUTBYTES>* outputs)
+{
+    hash_lanes<u32x16, 16>(messages, num_blocks, outputs);
+}
+
+__attribute__((target("avx2"))) void hash_lanes_avx2(const std::vector<uint8_t>* const* messages,
+                                                     const size_t num_blocks,
+                                                     std::array<uint8_t, BLAKE2S_OUTBYTES>* outputs)
+{
+    hash_lanes<u32x8, 8>(messages, num_blocks, outputs);
+}
+
+/**
+ * @brief Hash the messages in groups of LANES sharing a number of blocks, returning the indices of those left over
+ */
+template <size_t LANES, typename Kernel>
+std::vector<size_t> hash_lane_groups(const std::vector<std::vector<uint8_t>>& inputs,
+                                     Kernel kernel,
+                                     std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>>& outputs)
+{
+    std::map<size_t, std::vector<size_t>> messages_by_num_blocks;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        messages_by_num_blocks[MessageBlocks::get_num_blocks(inputs[i].size())].push_back(i);
+    }
+    std::vector<size_t> remaining;
+    for (const auto& [num_blocks, indices] : messages_by_num_blocks) {
+        size_t i = 0;
+        for (; i + LANES <= indices.size(); i += LANES) {
+            const std::vector<uint8_t>* lane_messages[LANES];
+            std::array<uint8_t, BLAKE2S_OUTBYTES> lane_outputs[LANES];
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                lane_messages[lane] = &inputs[indices[i + lane]];
+            }
+            kernel(lane_messages, num_blocks, lane_outputs);
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                outputs[indices[i + lane]] = lane_outputs[lane];
+            }
+        }
+        remaining.insert(remaining.end(), indices.begin() + static_cast<std::ptrdiff_t>(i), indices.end());
+    }
+    return remaining;
+}
+
+#endif
+
+} // namespace
+
+std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>> blake2s_many(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>> outputs(inputs.size());
+
+    // Indices of the messages left to the single-message path
+    std::vector<size_t> remaining;
+#ifdef BLAKE2S_X86_KERNELS
+    static const bool has_avx512 = __builtin_cpu_supports("avx512f");
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx512 || has_avx2) {
+        remaining = has_avx512 ? hash_lane_groups<16>(inputs, hash_lanes_avx512, outputs)
+                               : hash_lane_groups<8>(inputs, hash_lanes_avx2, outputs);
+    } else {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            remaining.push_back(i);
+        }
+    }
+#else
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        remaining.push_back(i);
+    }
+#endif
+    for (const size_t i : remaining) {
+        outputs[i] = blake2s(inputs[i]);
+    }
+    return outputs;
+}
+
+} // namespace bb::crypto
@@ -63,3 +63,32 @@ WASM_EXPORT bool ecdsa__verify_signature(uint8_t const* message,
     return bb::crypto::ecdsa_verify_signature<Sha256Hasher, secp256k1::fq, secp256k1::fr, secp256k1::g1>(
         std::string((char*)message, msg_len), pubk, sig);
 }
+
+// verifies num_signatures signatures, given a serialised vector of messages and flat arrays of 64-byte public keys,
+// 32-byte r and s values and 1-byte v values. Writes whether each signature is valid to `results`
+WASM_EXPORT void ecdsa__verify_signatures_batch(uint8_t const* messages,
+                                                uint8_t const* pub_keys,
+                                                uint8_t const* sigs_r,
+                                                uint8_t const* sigs_s,
+                                                uint8_t const* sigs_v,
+                                                uint32_t num_signatures,
+                                                bool* results)
+{
+    auto message_strings = from_buffer<std::vector<std::string>>(messages);
+    if (message_strings.size() != num_signatures) {
+        throw_or_abort("ecdsa__verify_signatures_batch: number of messages differs from num_signatures");
+    }
+    std::vector<secp256k1::g1::affine_element> pubks(num_signatures);
+    std::vector<bb::crypto::ecdsa_signature> sigs(num_signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        pubks[i] = from_buffer<secp256k1::g1::affine_element>(pub_keys + (i * 64));
+        std::copy(sigs_r + (i * 32), sigs_r + ((i + 1) * 32), sigs[i].r.begin());
+        std::copy(sigs_s + (i * 32), sigs_s + ((i + 1) * 32), sigs[i].s.begin());
+        sigs[i].v = sigs_v[i];
+    }
+    auto valid = bb::crypto::ecdsa_verify_signatures_batch<Sha256Hasher, secp256k1::fq, secp256k1::fr, secp256k1::g1>(
+        message_strings, pubks, sigs);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        results[i] = valid[i];
+    }
+}
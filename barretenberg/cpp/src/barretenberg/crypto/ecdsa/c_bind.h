@@ -23,3 +23,11 @@ WASM_EXPORT bool ecdsa__verify_signature(uint8_t const* message,
                                          uint8_t const* sig_r,
                                          uint8_t const* sig_s,
                                          uint8_t const* sig_v);
+
+WASM_EXPORT void ecdsa__verify_signatures_batch(uint8_t const* messages,
+                                                uint8_t const* pub_keys,
+                                                uint8_t const* sigs_r,
+                                                uint8_t const* sigs_s,
+                                                uint8_t const* sigs_v,
+                                                uint32_t num_signatures,
+                                                bool* results);
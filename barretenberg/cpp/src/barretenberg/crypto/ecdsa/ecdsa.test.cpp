@@ -179,3 +179,37 @@ TEST(ecdsa, verify_signature_secp256r1_sha256_NIST_1)
         message, public_key, sig);
     EXPECT_EQ(result, true);
 }
+
+TEST(ecdsa, verify_signatures_batch_secp256k1_sha256)
+{
+    using G1 = secp256k1::g1;
+    const size_t num_signatures = 40;
+    std::vector<std::string> messages;
+    std::vector<G1::affine_element> public_keys;
+    std::vector<crypto::ecdsa_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        messages.push_back("message " + std::to_string(i));
+        crypto::ecdsa_key_pair<secp256k1::fr, G1> account;
+        account.private_key = secp256k1::fr::random_element();
+        account.public_key = G1::one * account.private_key;
+        public_keys.push_back(account.public_key);
+        signatures.push_back(
+            crypto::ecdsa_construct_signature<Sha256Hasher, secp256k1::fq, secp256k1::fr, G1>(messages[i], account));
+    }
+
+    auto results = crypto::ecdsa_verify_signatures_batch<Sha256Hasher, secp256k1::fq, secp256k1::fr, G1>(
+        messages, public_keys, signatures);
+    EXPECT_EQ(results, std::vector<bool>(num_signatures, true));
+
+    // A signature on another message, one by another key, one with an out of range s, and one with the wrong recovery
+    // id, which ecdsa_verify_signature does not check
+    messages[3] = "another message";
+    public_keys[17] = G1::one * secp256k1::fr::random_element();
+    signatures[21].s.fill(0xff);
+    signatures[30].v ^= 1;
+    results = crypto::ecdsa_verify_signatures_batch<Sha256Hasher, secp256k1::fq, secp256k1::fr, G1>(
+        messages, public_keys, signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        EXPECT_EQ(results[i], i != 3 && i != 17 && i != 21);
+    }
+}
@@ -2,7 +2,11 @@
 
 #include "../hmac/hmac.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/bucket_msm.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
+#include <functional>
+#include <span>
 
 namespace bb::crypto {
 
@@ -170,4 +174,139 @@ bool ecdsa_verify_signature(const std::string& message,
     Fr result(Rx);
     return result == r;
 }
+
+/**
+ * @brief Verify a batch of signatures, returning whether each of them is valid
+ *
+ * @details With the nonce point R recovered from (r, v) as in ecdsa_recover_public_key, a valid signature (r, s) by P
+ * on a message hashing to z satisfies s.R = z.G + r.P. Rather than checking each of these equations with two scalar
+ * multiplications, we sample random a_i and check
+ *
+ *   sum_i (a_i.s_i).R_i - (a_i.r_i).P_i - (sum_i a_i.z_i).G = 0
+ *
+ * with a single MSM, which only holds with negligible probability if any of the equations does not. If the check
+ * fails, each half of the batch is checked in the same way, down to a few signatures which are verified one at a time,
+ * so a few invalid signatures among many are found with a logarithmic number of MSMs.
+ *
+ * ecdsa_verify_signature ignores v, so a signature whose R cannot be recovered from (r, v) is verified on its own. A
+ * signature with a high s is reported as invalid rather than aborting.
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_signatures_batch(const std::vector<std::string>& messages,
+                                                const std::vector<typename G1::affine_element>& public_keys,
+                                                const std::vector<ecdsa_signature>& signatures)
+{
+    using serialize::read;
+    using affine_element = typename G1::affine_element;
+    const size_t num_signatures = signatures.size();
+    if (messages.size() != num_signatures || public_keys.size() != num_signatures) {
+        throw_or_abort("ecdsa_verify_signatures_batch: numbers of messages, public keys and signatures differ");
+    }
+
+    enum Status : uint8_t { INVALID, BATCHED, SINGLE, VALID };
+    // The terms of the equation s.R = z.G + r.P of each batched signature
+    struct Terms {
+        affine_element R;
+        Fr z;
+        Fr r;
+        Fr s;
+    };
+    std::vector<uint8_t> status(num_signatures, INVALID);
+    std::vector<Terms> terms(num_signatures);
+
+    parallel_for(num_signatures, [&](size_t i) {
+        const ecdsa_signature& sig = signatures[i];
+        uint256_t r_uint;
+        uint256_t s_uint;
+        const auto* r_buf = &sig.r[0];
+        const auto* s_buf = &sig.s[0];
+        read(r_buf, r_uint);
+        read(s_buf, s_uint);
+        const uint256_t mod = uint256_t(Fr::modulus);
+        if (!public_keys[i].on_curve() || r_uint >= mod || s_uint >= mod || r_uint == 0 || s_uint == 0 ||
+            s_uint * 2 > mod) {
+            return;
+        }
+        if (sig.v < 27 || sig.v > 30) {
+            status[i] = SINGLE;
+            return;
+        }
+        const bool is_r_finite = sig.v < 29;
+        // An x-coordinate of r + |Fr| must still be less than |Fq|
+        const uint256_t fq_mod = uint256_t(Fq::modulus);
+        if (!is_r_finite && (fq_mod <= mod || r_uint >= fq_mod - mod)) {
+            status[i] = SINGLE;
+            return;
+        }
+        affine_element R = affine_element::from_compressed_unsafe(r_uint)[!is_r_finite];
+        if (!R.on_curve() || R.is_point_at_infinity()) {
+            status[i] = SINGLE;
+            return;
+        }
+        if ((sig.v & 1) ^ static_cast<uint8_t>(uint256_t(R.y).get_bit(0))) {
+            R.y = -R.y;
+        }
+
+        std::vector<uint8_t> message_buffer(messages[i].begin(), messages[i].end());
+        auto ev = Hash::hash(message_buffer);
+        terms[i] = { R, Fr::serialize_from_buffer(&ev[0]), Fr(r_uint), Fr(s_uint) };
+        status[i] = BATCHED;
+    });
+
+    const auto verify_single = [&](size_t i) {
+        status[i] = ecdsa_verify_signature<Hash, Fq, Fr, G1>(messages[i], public_keys[i], signatures[i]) ? VALID
+                                                                                                        : INVALID;
+    };
+
+    // Below this many signatures, the MSM no longer saves much over verifying them one at a time
+    constexpr size_t MIN_BATCH_SIZE = 4;
+    const std::function<void(std::span<const size_t>)> verify_batch = [&](std::span<const size_t> batch) {
+        if (batch.size() <= MIN_BATCH_SIZE) {
+            for (const size_t i : batch) {
+                verify_single(i);
+            }
+            return;
+        }
+        std::vector<affine_element> points;
+        std::vector<Fr> scalars;
+        points.reserve(2 * batch.size() + 1);
+        scalars.reserve(2 * batch.size() + 1);
+        Fr generator_scalar = Fr::zero();
+        for (const size_t i : batch) {
+            const Fr a = Fr::random_element();
+            points.push_back(terms[i].R);
+            scalars.push_back(a * terms[i].s);
+            points.push_back(public_keys[i]);
+            scalars.push_back(-(a * terms[i].r));
+            generator_scalar -= a * terms[i].z;
+        }
+        points.push_back(G1::affine_one);
+        scalars.push_back(generator_scalar);
+        if (scalar_multiplication::bucket_msm<G1>(points, scalars).is_point_at_infinity()) {
+            for (const size_t i : batch) {
+                status[i] = VALID;
+            }
+            return;
+        }
+        const size_t half = batch.size() / 2;
+        verify_batch(batch.subspan(0, half));
+        verify_batch(batch.subspan(half));
+    };
+
+    std::vector<size_t> batch;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        if (status[i] == BATCHED) {
+            batch.push_back(i);
+        } else if (status[i] == SINGLE) {
+            verify_single(i);
+        }
+    }
+    verify_batch(batch);
+
+    std::vector<bool> results(num_signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        results[i] = status[i] == VALID;
+    }
+    return results;
+}
 } // namespace bb::crypto
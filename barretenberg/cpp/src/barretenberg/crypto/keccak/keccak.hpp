@@ -38,3 +38,14 @@ struct keccak256 hash_field_element(const uint64_t* limb);
 #ifdef __cplusplus
 }
 #endif
+
+#ifdef __cplusplus
+#include <vector>
+
+/**
+ * @brief Keccak-256 of many independent messages; equivalent to calling ethash_keccak256 on each
+ * @details On x86_64, messages with the same number of blocks are hashed 8 (AVX-512) or 4 (AVX2) at a time across the
+ * lanes of vector registers, when the CPU supports it. The rest go through the scalar implementation.
+ */
+std::vector<struct keccak256> keccak256_many(const std::vector<std::vector<uint8_t>>& inputs);
+#endif
@@ -0,0 +1,39 @@
+#include "keccak.hpp"
+#include <gtest/gtest.h>
+#include <cstring>
+
+TEST(misc_keccak, keccak256_empty_string)
+{
+    const struct keccak256 result = ethash_keccak256(nullptr, 0);
+
+    const uint8_t expected[32]{
+        0xc5, 0xd2, 0x46, 0x01, 0x86, 0xf7, 0x23, 0x3c, 0x92, 0x7e, 0x7d, 0xb2, 0xdc, 0xc7, 0x03, 0xc0,
+        0xe5, 0x00, 0xb6, 0x53, 0xca, 0x82, 0x27, 0x3b, 0x7b, 0xfa, 0xd8, 0x04, 0x5d, 0x85, 0xa4, 0x70,
+    };
+
+    EXPECT_EQ(std::memcmp(result.word64s, expected, 32), 0);
+}
+
+TEST(misc_keccak, keccak256_many_matches_keccak256)
+{
+    // Enough messages of each length to fill whole lane groups, plus leftovers, across the rate boundaries
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t length = 0; length < 300; ++length) {
+        const size_t num_messages = length % 8 == 0 ? 19 : 1;
+        for (size_t i = 0; i < num_messages; ++i) {
+            std::vector<uint8_t> input(length);
+            for (size_t j = 0; j < length; ++j) {
+                input[j] = static_cast<uint8_t>(i * 31 + j * 7 + length);
+            }
+            inputs.push_back(input);
+        }
+    }
+
+    auto results = keccak256_many(inputs);
+
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const struct keccak256 expected = ethash_keccak256(inputs[i].data(), inputs[i].size());
+        EXPECT_EQ(std::memcmp(results[i].word64s, expected.word64s, 32), 0);
+    }
+}
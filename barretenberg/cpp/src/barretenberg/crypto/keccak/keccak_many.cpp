@@ -0,0 +1,246 @@
+#include "keccak.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#define KECCAK_X86_KERNELS 1
+#endif
+
+namespace {
+
+#ifdef KECCAK_X86_KERNELS
+
+// Keccak-256 absorbs 1088 bits (17 words) per permutation
+constexpr size_t RATE_BYTES = 136;
+constexpr size_t RATE_WORDS = RATE_BYTES / sizeof(uint64_t);
+
+/**
+ * @brief A message as a sequence of blocks: its whole blocks in place, then the rest of it and the padding in a copy
+ */
+struct MessageBlocks {
+    const uint8_t* data = nullptr;
+    size_t num_full_blocks = 0;
+    uint8_t tail[RATE_BYTES];
+
+    // The padding takes at least one byte, so there is always a final partial block
+    static size_t get_num_blocks(const size_t size) { return size / RATE_BYTES + 1; }
+
+    void init(const std::vector<uint8_t>& input)
+    {
+        data = input.data();
+        num_full_blocks = input.size() / RATE_BYTES;
+        const size_t remainder = input.size() - num_full_blocks * RATE_BYTES;
+        std::fill(std::begin(tail), std::end(tail), 0);
+        std::copy(input.end() - static_cast<std::ptrdiff_t>(remainder), input.end(), tail);
+        // Keccak (not SHA-3) padding: 0x01, zeroes and 0x80 in the last byte of the block
+        tail[remainder] ^= 0x01;
+        tail[RATE_BYTES - 1] ^= 0x80;
+    }
+
+    const uint8_t* block(const size_t i) const { return i < num_full_blocks ? data + i * RATE_BYTES : tail; }
+};
+
+// x86 is little-endian, so the message words load as they are
+uint64_t load_le64(const uint8_t* data)
+{
+    uint64_t word = 0;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+constexpr uint64_t round_constants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000, 0x000000000000808b,
+    0x0000000080000001, 0x8000000080008081, 0x8000000000008009, 0x000000000000008a, 0x0000000000000088,
+    0x0000000080008009, 0x000000008000000a, 0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+};
+
+// Rotation offsets and destination lanes of the combined rho and pi steps, following lane 1 around the permutation
+constexpr unsigned rho_offsets[24] = { 1,  3,  6,  10, 15, 21, 28, 36, 45, 55, 2,  14,
+                                       27, 41, 56, 8,  25, 43, 62, 18, 39, 61, 20, 44 };
+constexpr size_t pi_lanes[24] = { 10, 7,  11, 17, 18, 3, 5,  16, 8,  21, 24, 4,
+                                  15, 23, 19, 13, 12, 2, 20, 14, 22, 9,  6,  1 };
+
+// The generic lane kernels below return vectors by value, but are always inlined into the target-specific functions
+// calling them, so GCC's warning about the ABI of such returns does not apply
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+using u64x8 = uint64_t __attribute__((vector_size(64)));
+using u64x4 = uint64_t __attribute__((vector_size(32)));
+
+template <typename V> [[gnu::always_inline]] inline V rol(const V& val, unsigned shift)
+{
+    return (val << shift) | (val >> (64 - shift));
+}
+
+/**
+ * @brief Keccak-f[1600] applied to each of the states in the lanes of V
+ */
+template <typename V> [[gnu::always_inline]] inline void keccakf1600_lanes(V* state)
+{
+    // Work on a local copy so the state can live in registers across the rounds
+    V a[25];
+#pragma GCC unroll 25
+    for (size_t i = 0; i < 25; ++i) {
+        a[i] = state[i];
+    }
+    for (size_t round = 0; round < 24; ++round) {
+        // Theta
+        V column_parity[5];
+#pragma GCC unroll 5
+        for (size_t x = 0; x < 5; ++x) {
+            column_parity[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+        }
+#pragma GCC unroll 5
+        for (size_t x = 0; x < 5; ++x) {
+            const V d = column_parity[(x + 4) % 5] ^ rol(column_parity[(x + 1) % 5], 1);
+#pragma GCC unroll 5
+            for (size_t y = 0; y < 25; y += 5) {
+                a[y + x] ^= d;
+            }
+        }
+        // Rho and pi
+        V current = a[1];
+#pragma GCC unroll 24
+        for (size_t t = 0; t < 24; ++t) {
+            const V next = a[pi_lanes[t]];
+            a[pi_lanes[t]] = rol(current, rho_offsets[t]);
+            current = next;
+        }
+        // Chi
+#pragma GCC unroll 5
+        for (size_t y = 0; y < 25; y += 5) {
+            V row[5];
+#pragma GCC unroll 5
+            for (size_t x = 0; x < 5; ++x) {
+                row[x] = a[y + x];
+            }
+#pragma GCC unroll 5
+            for (size_t x = 0; x < 5; ++x) {
+                a[y + x] = row[x] ^ (~row[(x + 1) % 5] & row[(x + 2) % 5]);
+            }
+        }
+        // Iota
+        a[0] ^= round_constants[round];
+    }
+#pragma GCC unroll 25
+    for (size_t i = 0; i < 25; ++i) {
+        state[i] = a[i];
+    }
+}
+
+/**
+ * @brief Hash LANES messages with the same number of blocks, one per lane of V
+ */
+template <typename V, size_t LANES>
+[[gnu::always_inline]] inline void hash_lanes(const std::vector<uint8_t>* const* messages,
+                                              const size_t num_blocks,
+                                              keccak256* outputs)
+{
+    MessageBlocks lane_messages[LANES];
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        lane_messages[lane].init(*messages[lane]);
+    }
+    V state[25] = {};
+    for (size_t block = 0; block < num_blocks; ++block) {
+        // Transpose the block words through memory, so that each becomes a single vector load
+        V words[RATE_WORDS];
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            const uint8_t* data = lane_messages[lane].block(block);
+            for (size_t j = 0; j < RATE_WORDS; ++j) {
+                reinterpret_cast<uint64_t*>(&words[j])[lane] = load_le64(data + j * 8);
+            }
+        }
+        for (size_t j = 0; j < RATE_WORDS; ++j) {
+            state[j] ^= words[j];
+        }
+        keccakf1600_lanes(state);
+    }
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        for (size_t j = 0; j < 4; ++j) {
+            outputs[lane].word64s[j] = state[j][lane];
+        }
+    }
+}
+
+__attribute__((target("avx512f"))) void hash_lanes_avx512(const std::vector<uint8_t>* const* messages,
+                                                          const size_t num_blocks,
+                                                          keccak256* outputs)
+{
+    hash_lanes<u64x8, 8>(messages, num_blocks, outputs);
+}
+
+__attribute__((target("avx2"))) void hash_lanes_avx2(const std::vector<uint8_t>* const* messages,
+                                                     const size_t num_blocks,
+                                                     keccak256* outputs)
+{
+    hash_lanes<u64x4, 4>(messages, num_blocks, outputs);
+}
+
+/**
+ * @brief Hash the messages in groups of LANES sharing a number of blocks, returning the indices of those left over
+ */
+template <size_t LANES, typename Kernel>
+std::vector<size_t> hash_lane_groups(const std::vector<std::vector<uint8_t>>& inputs,
+                                     Kernel kernel,
+                                     std::vector<keccak256>& outputs)
+{
+    std::map<size_t, std::vector<size_t>> messages_by_num_blocks;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        messages_by_num_blocks[MessageBlocks::get_num_blocks(inputs[i].size())].push_back(i);
+    }
+    std::vector<size_t> remaining;
+    for (const auto& [num_blocks, indices] : messages_by_num_blocks) {
+        size_t i = 0;
+        for (; i + LANES <= indices.size(); i += LANES) {
+            const std::vector<uint8_t>* lane_messages[LANES];
+            keccak256 lane_outputs[LANES];
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                lane_messages[lane] = &inputs[indices[i + lane]];
+            }
+            kernel(lane_messages, num_blocks, lane_outputs);
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                outputs[indices[i + lane]] = lane_outputs[lane];
+            }
+        }
+        remaining.insert(remaining.end(), indices.begin() + static_cast<std::ptrdiff_t>(i), indices.end());
+    }
+    return remaining;
+}
+
+#endif
+
+} // namespace
+
+std::vector<keccak256> keccak256_many(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    std::vector<keccak256> outputs(inputs.size());
+
+    // Indices of the messages left to the single-message path
+    std::vector<size_t> remaining;
+#ifdef KECCAK_X86_KERNELS
+    static const bool has_avx512 = __builtin_cpu_supports("avx512f");
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx512 || has_avx2) {
+        remaining = has_avx512 ? hash_lane_groups<8>(inputs, hash_lanes_avx512, outputs)
+                               : hash_lane_groups<4>(inputs, hash_lanes_avx2, outputs);
+    } else {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            remaining.push_back(i);
+        }
+    }
+#else
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        remaining.push_back(i);
+    }
+#endif
+    for (const size_t i : remaining) {
+        outputs[i] = ethash_keccak256(inputs[i].data(), inputs[i].size());
+    }
+    return outputs;
+}
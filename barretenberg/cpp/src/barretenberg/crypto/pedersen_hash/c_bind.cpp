@@ -24,4 +24,27 @@ WASM_EXPORT void pedersen_hash_buffer(uint8_t const* input_buffer, uint32_t cons
     auto r = crypto::pedersen_hash::hash_buffer(to_hash, ctx);
     bb::fr::serialize_to_buffer(r, output);
 }
-}
\ No newline at end of file
+
+WASM_EXPORT void pedersen_hash_batch(uint8_t const* inputs_buffer,
+                                     uint32_t const* hash_size,
+                                     uint32_t const* hash_index,
+                                     uint8_t** output)
+{
+    std::vector<grumpkin::fq> to_hash;
+    read(inputs_buffer, to_hash);
+    crypto::GeneratorContext<curve::Grumpkin> ctx;
+    ctx.offset = static_cast<size_t>(ntohl(*hash_index));
+    auto r = crypto::pedersen_hash::hash_batch(to_hash, static_cast<size_t>(ntohl(*hash_size)), ctx);
+    *output = to_heap_buffer(r);
+}
+
+WASM_EXPORT void pedersen_hash_pairs(uint8_t const* inputs_buffer, uint32_t const* hash_index, uint8_t** output)
+{
+    std::vector<grumpkin::fq> to_hash;
+    read(inputs_buffer, to_hash);
+    crypto::GeneratorContext<curve::Grumpkin> ctx;
+    ctx.offset = static_cast<size_t>(ntohl(*hash_index));
+    auto r = crypto::pedersen_hash::hash_batch(to_hash, 2, ctx);
+    *output = to_heap_buffer(r);
+}
+}
@@ -10,4 +10,18 @@ using namespace bb;
 WASM_EXPORT void pedersen_hash(fr::vec_in_buf inputs_buffer, uint32_t const* hash_index, fr::out_buf output);
 
 WASM_EXPORT void pedersen_hash_buffer(uint8_t const* input_buffer, uint32_t const* hash_index, fr::out_buf output);
-}
\ No newline at end of file
+
+/**
+ * Hashes each consecutive run of `hash_size` elements of the flat `inputs_buffer`, returning one hash per run.
+ * The hashes are spread across threads.
+ */
+WASM_EXPORT void pedersen_hash_batch(fr::vec_in_buf inputs_buffer,
+                                     uint32_t const* hash_size,
+                                     uint32_t const* hash_index,
+                                     fr::vec_out_buf output);
+
+/**
+ * Hashes the pairs (inputs[2i], inputs[2i + 1]) of `inputs_buffer`, e.g. one layer of a Merkle tree into the next.
+ */
+WASM_EXPORT void pedersen_hash_pairs(fr::vec_in_buf inputs_buffer, uint32_t const* hash_index, fr::vec_out_buf output);
+}
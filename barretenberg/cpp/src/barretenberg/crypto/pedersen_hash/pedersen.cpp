@@ -1,5 +1,8 @@
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 
 namespace bb::crypto {
 
@@ -79,5 +82,40 @@ typename Curve::BaseField pedersen_hash_base<Curve>::hash_buffer(const std::vect
     return result;
 }
 
+/**
+ * @brief Hash each consecutive run of `hash_size` elements of `inputs`, spreading the hashes across threads
+ *
+ * @details Equivalent to calling `hash` on each run, e.g. `hash_size = 2` hashes the pairs making up a layer of a
+ * Merkle tree.
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(const std::vector<Fq>& inputs,
+                                                                             const size_t hash_size,
+                                                                             const GeneratorContext context)
+{
+    if (hash_size == 0 || inputs.size() % hash_size != 0) {
+        throw_or_abort("pedersen_hash::hash_batch: input size is not a multiple of the hash size");
+    }
+    const size_t num_hashes = inputs.size() / hash_size;
+    std::vector<Fq> results(num_hashes);
+
+    // Derive any generators beyond the precomputed ones up front: `generator_data::get` only writes to its cache
+    // when it has to extend it, so after this the threads only read from it
+    static_cast<void>(context.generators->get(hash_size, context.offset, context.domain_separator));
+
+    const size_t num_threads = thread_utils::calculate_num_threads(num_hashes);
+    const size_t hashes_per_thread = (num_hashes + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * hashes_per_thread;
+        const size_t end = std::min(start + hashes_per_thread, num_hashes);
+        std::vector<Fq> to_hash(hash_size);
+        for (size_t i = start; i < end; ++i) {
+            std::copy_n(inputs.begin() + static_cast<std::ptrdiff_t>(i * hash_size), hash_size, to_hash.begin());
+            results[i] = hash(to_hash, context);
+        }
+    });
+    return results;
+}
+
 template class pedersen_hash_base<curve::Grumpkin>;
 } // namespace bb::crypto
\ No newline at end of file
@@ -31,6 +31,9 @@ template <typename Curve> class pedersen_hash_base {
     inline static constexpr AffineElement length_generator = Group::derive_generators("pedersen_hash_length", 1)[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
+    static std::vector<Fq> hash_batch(const std::vector<Fq>& inputs,
+                                      size_t hash_size,
+                                      GeneratorContext context = {});
 
   private:
     static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
@@ -1,5 +1,6 @@
 #include "pedersen.hpp"
 #include "barretenberg/crypto/generators/generator_data.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include <gtest/gtest.h>
 
@@ -21,4 +22,25 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
+TEST(Pedersen, HashBatch)
+{
+    auto& engine = numeric::get_debug_randomness();
+    // Hash sizes within and beyond the precomputed generators
+    for (const size_t hash_size : std::vector<size_t>{ 1, 2, 3, 10 }) {
+        std::vector<fr> inputs(37 * hash_size);
+        for (auto& input : inputs) {
+            input = fr::random_element(&engine);
+        }
+
+        auto results = pedersen_hash::hash_batch(inputs, hash_size, 3);
+
+        ASSERT_EQ(results.size(), 37);
+        for (size_t i = 0; i < results.size(); ++i) {
+            std::vector<fr> to_hash(inputs.begin() + static_cast<std::ptrdiff_t>(i * hash_size),
+                                    inputs.begin() + static_cast<std::ptrdiff_t>((i + 1) * hash_size));
+            EXPECT_EQ(results[i], pedersen_hash::hash(to_hash, 3));
+        }
+    }
+}
+
 } // namespace bb::crypto
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "c_bind.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "poseidon2.hpp"
+
+extern "C" {
+
+WASM_EXPORT void poseidon2_hash(uint8_t const* inputs_buffer, uint8_t* output)
+{
+    std::vector<fr> to_hash;
+    read(inputs_buffer, to_hash);
+    auto r = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash(to_hash);
+    fr::serialize_to_buffer(r, output);
+}
+
+WASM_EXPORT void poseidon2_hash_batch(uint8_t const* inputs_buffer, uint32_t const* hash_size, uint8_t** output)
+{
+    std::vector<fr> to_hash;
+    read(inputs_buffer, to_hash);
+    auto r = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_batch(
+        to_hash, static_cast<size_t>(ntohl(*hash_size)));
+    *output = to_heap_buffer(r);
+}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "barretenberg/common/wasm_export.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+
+extern "C" {
+
+using namespace bb;
+
+WASM_EXPORT void poseidon2_hash(fr::vec_in_buf inputs_buffer, fr::out_buf output);
+
+/**
+ * Hashes each consecutive run of `hash_size` elements of the flat `inputs_buffer`, returning one hash per run.
+ * The hashes are spread across threads.
+ */
+WASM_EXPORT void poseidon2_hash_batch(fr::vec_in_buf inputs_buffer, uint32_t const* hash_size, fr::vec_out_buf output);
+}
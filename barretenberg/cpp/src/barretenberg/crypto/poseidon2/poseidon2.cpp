@@ -1,4 +1,7 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 
 namespace bb::crypto {
 /**
@@ -44,5 +47,35 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash_buffer(const std::vector<
     return hash(converted);
 }
 
+/**
+ * @brief Hashes each consecutive run of `hash_size` elements of `inputs`, spreading the hashes across threads
+ * @details Equivalent to calling hash() on each run.
+ */
+template <typename Params>
+std::vector<typename Poseidon2<Params>::FF> Poseidon2<Params>::hash_batch(
+    const std::vector<typename Poseidon2<Params>::FF>& inputs, const size_t hash_size)
+{
+    if (hash_size == 0 || inputs.size() % hash_size != 0) {
+        throw_or_abort("Poseidon2::hash_batch: input size is not a multiple of the hash size");
+    }
+    const size_t num_hashes = inputs.size() / hash_size;
+    std::vector<FF> results(num_hashes);
+
+    // A hash is a handful of permutations, so give each thread enough of them to pay for its dispatch
+    constexpr size_t MIN_HASHES_PER_THREAD = 1 << 6;
+    const size_t num_threads = thread_utils::calculate_num_threads(num_hashes, MIN_HASHES_PER_THREAD);
+    const size_t hashes_per_thread = (num_hashes + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * hashes_per_thread;
+        const size_t end = std::min(start + hashes_per_thread, num_hashes);
+        std::vector<FF> to_hash(hash_size);
+        for (size_t i = start; i < end; ++i) {
+            std::copy_n(inputs.begin() + static_cast<std::ptrdiff_t>(i * hash_size), hash_size, to_hash.begin());
+            results[i] = Sponge::hash_fixed_length(to_hash);
+        }
+    });
+    return results;
+}
+
 template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
 } // namespace bb::crypto
\ No newline at end of file
@@ -22,6 +22,10 @@ template <typename Params> class Poseidon2 {
      * @details Slice function cuts out the required number of bytes from the byte vector
      */
     static FF hash_buffer(const std::vector<uint8_t>& input);
+    /**
+     * @brief Hashes each consecutive run of `hash_size` elements of `inputs`, spreading the hashes across threads
+     */
+    static std::vector<FF> hash_batch(const std::vector<FF>& inputs, size_t hash_size);
 };
 
 extern template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
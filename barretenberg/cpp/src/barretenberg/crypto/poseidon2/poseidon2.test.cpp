@@ -61,3 +61,22 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
 
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2, HashBatch)
+{
+    for (const size_t hash_size : std::vector<size_t>{ 1, 2, 3, 5 }) {
+        std::vector<fr> inputs(100 * hash_size);
+        for (auto& input : inputs) {
+            input = fr::random_element(&engine);
+        }
+
+        auto results = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_batch(inputs, hash_size);
+
+        ASSERT_EQ(results.size(), 100);
+        for (size_t i = 0; i < results.size(); ++i) {
+            std::vector<fr> to_hash(inputs.begin() + static_cast<std::ptrdiff_t>(i * hash_size),
+                                    inputs.begin() + static_cast<std::ptrdiff_t>((i + 1) * hash_size));
+            EXPECT_EQ(results[i], crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash(to_hash));
+        }
+    }
+}
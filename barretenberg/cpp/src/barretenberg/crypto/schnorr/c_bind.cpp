@@ -52,6 +52,28 @@ WASM_EXPORT void schnorr_verify_signature(
         crypto::schnorr_verify_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(message, pubk, sig);
 }
 
+WASM_EXPORT void schnorr_verify_signatures_batch(uint8_t const* messages_buf,
+                                                 uint8_t const* pub_keys_buf,
+                                                 uint8_t const* sigs_s_buf,
+                                                 uint8_t const* sigs_e_buf,
+                                                 uint8_t** results)
+{
+    auto messages = from_buffer<std::vector<std::string>>(messages_buf);
+    auto pub_keys = from_buffer<std::vector<grumpkin::g1::affine_element>>(pub_keys_buf);
+    auto sigs_s = from_buffer<std::vector<std::array<uint8_t, 32>>>(sigs_s_buf);
+    auto sigs_e = from_buffer<std::vector<std::array<uint8_t, 32>>>(sigs_e_buf);
+    if (sigs_s.size() != sigs_e.size()) {
+        throw_or_abort("schnorr_verify_signatures_batch: numbers of s and e values differ");
+    }
+    std::vector<crypto::schnorr_signature> sigs(sigs_s.size());
+    for (size_t i = 0; i < sigs.size(); ++i) {
+        sigs[i] = { sigs_s[i], sigs_e[i] };
+    }
+    auto valid = crypto::schnorr_verify_signatures_batch<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+        messages, pub_keys, sigs);
+    *results = to_heap_buffer(std::vector<uint8_t>(valid.begin(), valid.end()));
+}
+
 WASM_EXPORT void schnorr_multisig_create_multisig_public_key(uint8_t const* private_key, uint8_t* multisig_pubkey_buf)
 {
     using multisig = crypto::schnorr_multisig<grumpkin::g1, KeccakHasher, Blake2sHasher>;
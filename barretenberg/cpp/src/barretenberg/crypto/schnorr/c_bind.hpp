@@ -17,6 +17,12 @@ WASM_EXPORT void schnorr_construct_signature(uint8_t const* message, fr::in_buf
 WASM_EXPORT void schnorr_verify_signature(
     uint8_t const* message, affine_element::in_buf pub_key, in_buf32 sig_s, in_buf32 sig_e, bool* result);
 
+WASM_EXPORT void schnorr_verify_signatures_batch(uint8_t const* messages,
+                                                 affine_element::vec_in_buf pub_keys,
+                                                 uint8_t const* sigs_s,
+                                                 uint8_t const* sigs_e,
+                                                 uint8_t** results);
+
 WASM_EXPORT void schnorr_multisig_create_multisig_public_key(fq::in_buf private_key,
                                                              multisig::MultiSigPublicKey::out_buf multisig_pubkey_buf);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/hmac/hmac.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 
@@ -153,4 +154,75 @@ bool schnorr_verify_signature(const std::string& message,
     auto target_e = schnorr_generate_challenge<Hash, G1>(message, public_key, R);
     return std::equal(sig.e.begin(), sig.e.end(), target_e.begin(), target_e.end());
 }
+
+/**
+ * @brief Verify a batch of Schnorr signatures, returning whether each of them is valid
+ *
+ * @details Our signatures are (s, e) rather than (s, R): R is only known by recomputing it as s.G + e.P, and each R
+ * then has to be hashed into its own challenge, so there is no single equation the signatures can be combined into.
+ * Instead, the work of schnorr_verify_signature is batched across the signatures: the R's are computed across
+ * threads and normalised with a single batch inversion, and the pedersen compressions of the challenges are computed
+ * with one batched hash. Each signature gets exactly the result schnorr_verify_signature would give it.
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> schnorr_verify_signatures_batch(const std::vector<std::string>& messages,
+                                                  const std::vector<typename G1::affine_element>& public_keys,
+                                                  const std::vector<schnorr_signature>& signatures)
+{
+    using element = typename G1::element;
+    const size_t num_signatures = signatures.size();
+    if (messages.size() != num_signatures || public_keys.size() != num_signatures) {
+        throw_or_abort("schnorr_verify_signatures_batch: numbers of messages, public keys and signatures differ");
+    }
+
+    // R = g^{sig.s} • pub^{sig.e}, or the point at infinity for signatures failing the checks before it
+    std::vector<element> R(num_signatures);
+    run_loop_in_parallel_if_effective(
+        num_signatures,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                R[i].self_set_infinity();
+                const auto& public_key = public_keys[i];
+                if (!public_key.on_curve() || public_key.is_point_at_infinity()) {
+                    continue;
+                }
+                Fr e = Fr::serialize_from_buffer(&signatures[i].e[0]);
+                Fr s = Fr::serialize_from_buffer(&signatures[i].s[0]);
+                if (s == 0 || e == 0) {
+                    continue;
+                }
+                R[i] = element(public_key) * e + G1::one * s;
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/0,
+        /*finite_field_inversions_per_iteration=*/0,
+        /*group_element_additions_per_iteration=*/0,
+        /*group_element_doublings_per_iteration=*/0,
+        /*scalar_multiplications_per_iteration=*/2);
+    element::batch_normalize(R.data(), num_signatures);
+
+    // Compress (R.x, pubkey.x, pubkey.y) for every signature still standing
+    std::vector<size_t> remaining;
+    std::vector<Fq> compression_inputs;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        if (!R[i].is_point_at_infinity()) {
+            remaining.push_back(i);
+            compression_inputs.insert(compression_inputs.end(), { R[i].x, public_keys[i].x, public_keys[i].y });
+        }
+    }
+    std::vector<Fq> compressed_keys = crypto::pedersen_hash::hash_batch(compression_inputs, 3);
+
+    std::vector<uint8_t> valid(num_signatures, 0);
+    parallel_for(remaining.size(), [&](size_t j) {
+        const size_t i = remaining[j];
+        std::vector<uint8_t> e_buffer;
+        write(e_buffer, compressed_keys[j]);
+        std::copy(messages[i].begin(), messages[i].end(), std::back_inserter(e_buffer));
+        auto target_e = Hash::hash(e_buffer);
+        valid[i] = static_cast<uint8_t>(
+            std::equal(signatures[i].e.begin(), signatures[i].e.end(), target_e.begin(), target_e.end()));
+    });
+    return std::vector<bool>(valid.begin(), valid.end());
+}
 } // namespace bb::crypto
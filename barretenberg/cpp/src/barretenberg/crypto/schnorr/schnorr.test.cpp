@@ -137,3 +137,34 @@ TEST(schnorr, hmac_signature_consistency)
         message_b, account_b.public_key, signature_h);
     EXPECT_EQ(res, true);
 }
+
+TEST(schnorr, verify_signatures_batch)
+{
+    using G1 = grumpkin::g1;
+    const size_t num_signatures = 20;
+    std::vector<std::string> messages;
+    std::vector<G1::affine_element> public_keys;
+    std::vector<schnorr_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        messages.push_back("message " + std::to_string(i));
+        auto account = generate_signature();
+        public_keys.push_back(account.public_key);
+        signatures.push_back(
+            schnorr_construct_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, G1>(messages[i], account));
+    }
+
+    // A signature on another message, one by another key, one with a zero s, and one by the point at infinity
+    messages[2] = "another message";
+    public_keys[5] = generate_signature().public_key;
+    signatures[11].s.fill(0);
+    public_keys[16].self_set_infinity();
+
+    auto results = schnorr_verify_signatures_batch<Blake2sHasher, grumpkin::fq, grumpkin::fr, G1>(
+        messages, public_keys, signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        const bool expected = schnorr_verify_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, G1>(
+            messages[i], public_keys[i], signatures[i]);
+        EXPECT_EQ(results[i], expected);
+        EXPECT_EQ(results[i], i != 2 && i != 5 && i != 11 && i != 16);
+    }
+}
@@ -15,6 +15,14 @@ hash sha256_block(const std::vector<uint8_t>& input);
 
 template <typename T> hash sha256(const T& input);
 
+/**
+ * @brief Hash many independent messages; equivalent to calling sha256 on each
+ * @details On x86_64, messages with the same padded length are hashed 16 at a time across the lanes of AVX-512
+ * registers, and the rest one at a time with the SHA extensions, when the CPU supports them. Otherwise falls back to the
+ * scalar implementation.
+ */
+std::vector<hash> sha256_many(const std::vector<std::vector<uint8_t>>& inputs);
+
 inline bb::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256::sha256(input);
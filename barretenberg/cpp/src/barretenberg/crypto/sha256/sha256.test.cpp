@@ -98,3 +98,27 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+TEST(misc_sha256, sha256_many_matches_sha256)
+{
+    // Enough messages of each length to fill whole lane groups, plus leftovers, across the one/two padding block
+    // boundary
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t length = 0; length < 200; ++length) {
+        const size_t num_messages = length % 8 == 0 ? 35 : 1;
+        for (size_t i = 0; i < num_messages; ++i) {
+            std::vector<uint8_t> input(length);
+            for (size_t j = 0; j < length; ++j) {
+                input[j] = static_cast<uint8_t>(i * 31 + j * 7 + length);
+            }
+            inputs.push_back(input);
+        }
+    }
+
+    auto results = sha256::sha256_many(inputs);
+
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], sha256::sha256(inputs[i]));
+    }
+}
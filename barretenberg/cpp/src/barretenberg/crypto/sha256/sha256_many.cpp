@@ -0,0 +1,308 @@
+#include "./sha256.hpp"
+#include <algorithm>
+#include <map>
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define SHA256_X86_KERNELS 1
+#endif
+
+namespace sha256 {
+
+namespace {
+
+#ifdef SHA256_X86_KERNELS
+
+constexpr uint32_t init_constants[8]{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+alignas(16) constexpr uint32_t round_constants[64]{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+constexpr size_t BLOCK_BYTES = 64;
+
+/**
+ * @brief A message as a sequence of blocks: its whole blocks in place, then the rest of it and the padding in a copy
+ */
+struct MessageBlocks {
+    // The padding (0x80, zeroes and the 64-bit big-endian bit length) may spill into a second block
+    static constexpr size_t MAX_TAIL_BYTES = 2 * BLOCK_BYTES;
+
+    const uint8_t* data = nullptr;
+    size_t num_full_blocks = 0;
+    uint8_t tail[MAX_TAIL_BYTES];
+
+    static size_t get_num_blocks(const size_t size) { return (size + 9 + BLOCK_BYTES - 1) / BLOCK_BYTES; }
+
+    void init(const std::vector<uint8_t>& input)
+    {
+        data = input.data();
+        num_full_blocks = input.size() / BLOCK_BYTES;
+        const size_t tail_size = (get_num_blocks(input.size()) - num_full_blocks) * BLOCK_BYTES;
+        const size_t remainder = input.size() - num_full_blocks * BLOCK_BYTES;
+        std::fill(tail, tail + tail_size, 0);
+        std::copy(input.end() - static_cast<std::ptrdiff_t>(remainder), input.end(), tail);
+        tail[remainder] = 0x80;
+        const uint64_t num_bits = static_cast<uint64_t>(input.size()) * 8;
+        for (size_t j = 0; j < 8; ++j) {
+            tail[tail_size - 1 - j] = static_cast<uint8_t>(num_bits >> (j * 8));
+        }
+    }
+
+    const uint8_t* block(const size_t i) const
+    {
+        return i < num_full_blocks ? data + i * BLOCK_BYTES : tail + (i - num_full_blocks) * BLOCK_BYTES;
+    }
+};
+
+uint32_t load_be32(const uint8_t* data)
+{
+    return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+           (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]);
+}
+
+hash state_to_hash(const uint32_t* state)
+{
+    hash output;
+    for (size_t j = 0; j < 8; ++j) {
+        output[j * 4] = static_cast<uint8_t>(state[j] >> 24);
+        output[j * 4 + 1] = static_cast<uint8_t>(state[j] >> 16);
+        output[j * 4 + 2] = static_cast<uint8_t>(state[j] >> 8);
+        output[j * 4 + 3] = static_cast<uint8_t>(state[j]);
+    }
+    return output;
+}
+
+/**
+ * @brief Compress the `num_blocks` blocks of a message into `state`, using the SHA extensions
+ * @details Each _mm_sha256rnds2_epu32 performs two rounds on a state held as (ABEF, CDGH); the message schedule is
+ * extended four words at a time with _mm_sha256msg1_epu32 / _mm_sha256msg2_epu32.
+ */
+__attribute__((target("sha,sse4.1"))) void compress_blocks_shani(uint32_t* state,
+                                                                 const MessageBlocks& message,
+                                                                 size_t num_blocks)
+{
+    // Byte shuffle converting each big-endian message word to native order
+    const __m128i byte_swap_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // Rearrange the state (ABCD, EFGH) into the (ABEF, CDGH) layout used by the round instructions
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+    __m128i state_1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+    __m128i state_0 = _mm_alignr_epi8(tmp, state_1, 8);
+    state_1 = _mm_blend_epi16(state_1, tmp, 0xF0);
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const uint8_t* data = message.block(block);
+        const __m128i abef_save = state_0;
+        const __m128i cdgh_save = state_1;
+        // Rolling window over the last four quadruples of message words
+        __m128i w[4];
+        for (size_t i = 0; i < 16; ++i) {
+            if (i < 4) {
+                w[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i)),
+                                        byte_swap_mask);
+            } else {
+                w[i & 3] = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]),
+                                                              _mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4)),
+                                                w[(i + 3) & 3]);
+            }
+            __m128i msg =
+                _mm_add_epi32(w[i & 3], _mm_load_si128(reinterpret_cast<const __m128i*>(&round_constants[4 * i])));
+            state_1 = _mm_sha256rnds2_epu32(state_1, state_0, msg);
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state_0 = _mm_sha256rnds2_epu32(state_0, state_1, msg);
+        }
+        state_0 = _mm_add_epi32(state_0, abef_save);
+        state_1 = _mm_add_epi32(state_1, cdgh_save);
+    }
+
+    // And back again
+    tmp = _mm_shuffle_epi32(state_0, 0x1B);
+    state_1 = _mm_shuffle_epi32(state_1, 0xB1);
+    state_0 = _mm_blend_epi16(tmp, state_1, 0xF0);
+    state_1 = _mm_alignr_epi8(state_1, tmp, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state_0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state_1);
+}
+
+bool cpu_supports_sha_ni()
+{
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return ((ebx >> 29) & 1) != 0 && __builtin_cpu_supports("sse4.1");
+}
+
+// The generic lane kernels below return vectors by value, but are always inlined into the target-specific functions
+// calling them, so GCC's warning about the ABI of such returns does not apply
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+using u32x16 = uint32_t __attribute__((vector_size(64)));
+
+template <uint32_t shift, typename V> [[gnu::always_inline]] inline V ror(const V& val)
+{
+    return (val >> shift) | (val << (32 - shift));
+}
+
+/**
+ * @brief SHA-256 compression of one block of each of the messages in the lanes of V
+ * @details Written with generic vector extensions so the same code serves any lane count; it is inlined into a
+ * function compiled for the target ISA.
+ */
+template <typename V> [[gnu::always_inline]] inline void compress_lanes(V* state, const V* block)
+{
+    V w[64];
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = block[i];
+    }
+    for (size_t i = 16; i < 64; ++i) {
+        const V s0 = ror<7>(w[i - 15]) ^ ror<18>(w[i - 15]) ^ (w[i - 15] >> 3);
+        const V s1 = ror<17>(w[i - 2]) ^ ror<19>(w[i - 2]) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + w[i - 7] + s0 + s1;
+    }
+    V a = state[0];
+    V b = state[1];
+    V c = state[2];
+    V d = state[3];
+    V e = state[4];
+    V f = state[5];
+    V g = state[6];
+    V h = state[7];
+    for (size_t i = 0; i < 64; ++i) {
+        const V S1 = ror<6>(e) ^ ror<11>(e) ^ ror<25>(e);
+        const V ch = (e & f) ^ (~e & g);
+        const V temp1 = h + S1 + ch + round_constants[i] + w[i];
+        const V S0 = ror<2>(a) ^ ror<13>(a) ^ ror<22>(a);
+        const V maj = (a & b) ^ (a & c) ^ (b & c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + S0 + maj;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+constexpr size_t AVX512_LANES = 16;
+
+/**
+ * @brief Hash 16 messages with the same number of blocks, one per lane
+ */
+__attribute__((target("avx512f"))) void hash_lanes_avx512(const std::vector<uint8_t>* const* messages,
+                                                          const size_t num_blocks,
+                                                          hash* outputs)
+{
+    MessageBlocks lane_messages[AVX512_LANES];
+    for (size_t lane = 0; lane < AVX512_LANES; ++lane) {
+        lane_messages[lane].init(*messages[lane]);
+    }
+    u32x16 state[8];
+    for (size_t j = 0; j < 8; ++j) {
+        state[j] = u32x16{} + init_constants[j];
+    }
+    for (size_t block = 0; block < num_blocks; ++block) {
+        u32x16 words[16];
+        for (size_t lane = 0; lane < AVX512_LANES; ++lane) {
+            const uint8_t* data = lane_messages[lane].block(block);
+            for (size_t j = 0; j < 16; ++j) {
+                words[j][lane] = load_be32(data + j * 4);
+            }
+        }
+        compress_lanes(state, words);
+    }
+    for (size_t lane = 0; lane < AVX512_LANES; ++lane) {
+        uint32_t lane_state[8];
+        for (size_t j = 0; j < 8; ++j) {
+            lane_state[j] = state[j][lane];
+        }
+        outputs[lane] = state_to_hash(lane_state);
+    }
+}
+
+#endif
+
+} // namespace
+
+std::vector<hash> sha256_many(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    std::vector<hash> outputs(inputs.size());
+
+    // Indices of the messages left to the single-message path
+    std::vector<size_t> remaining;
+#ifdef SHA256_X86_KERNELS
+    static const bool has_avx512 = __builtin_cpu_supports("avx512f");
+    static const bool has_sha_ni = cpu_supports_sha_ni();
+    if (has_avx512) {
+        // Messages sharing a lane group must have the same number of blocks
+        std::map<size_t, std::vector<size_t>> messages_by_num_blocks;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            messages_by_num_blocks[MessageBlocks::get_num_blocks(inputs[i].size())].push_back(i);
+        }
+        for (const auto& [num_blocks, indices] : messages_by_num_blocks) {
+            size_t i = 0;
+            for (; i + AVX512_LANES <= indices.size(); i += AVX512_LANES) {
+                const std::vector<uint8_t>* lane_messages[AVX512_LANES];
+                hash lane_outputs[AVX512_LANES];
+                for (size_t lane = 0; lane < AVX512_LANES; ++lane) {
+                    lane_messages[lane] = &inputs[indices[i + lane]];
+                }
+                hash_lanes_avx512(lane_messages, num_blocks, lane_outputs);
+                for (size_t lane = 0; lane < AVX512_LANES; ++lane) {
+                    outputs[indices[i + lane]] = lane_outputs[lane];
+                }
+            }
+            remaining.insert(remaining.end(), indices.begin() + static_cast<std::ptrdiff_t>(i), indices.end());
+        }
+    } else {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            remaining.push_back(i);
+        }
+    }
+    if (has_sha_ni) {
+        for (const size_t i : remaining) {
+            MessageBlocks message;
+            message.init(inputs[i]);
+            uint32_t state[8];
+            std::copy(std::begin(init_constants), std::end(init_constants), std::begin(state));
+            compress_blocks_shani(state, message, MessageBlocks::get_num_blocks(inputs[i].size()));
+            outputs[i] = state_to_hash(state);
+        }
+        return outputs;
+    }
+#else
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        remaining.push_back(i);
+    }
+#endif
+    for (const size_t i : remaining) {
+        outputs[i] = sha256(inputs[i]);
+    }
+    return outputs;
+}
+
+} // namespace sha256
@@ -1,12 +1,108 @@
 #include "acir_format.hpp"
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include "barretenberg/proof_system/plookup_tables/plookup_tables.hpp"
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
 
 namespace acir_format {
 
+namespace {
+
+/**
+ * @brief Runs of black box constraints, which are added to the builder one run at a time
+ *
+ * @details The constraints of a run do not depend on one another. In parallel mode, which only UltraCircuitBuilder
+ * supports, the constraints of all runs are cut into chunks, about one per thread, and each chunk is built on its own
+ * thread in a sub-builder of the builder as it is before the first run. Adding a run then splices its chunks into the
+ * builder in order (see UltraCircuitBuilder::splice_sub_builder), which gives the same circuit as building them in the
+ * builder would, so runs can be interleaved with constraints that are built in the builder directly. A chunk that does
+ * not splice, e.g. because it uses a witness that an earlier chunk has copy constrained, is built in the builder.
+ */
+template <typename Builder> class BlackBoxRuns {
+  public:
+    using Constraint = std::function<void(Builder&)>;
+
+    BlackBoxRuns(Builder const& builder, std::vector<std::vector<Constraint>> runs, bool parallel)
+        : runs(std::move(runs))
+    {
+        if constexpr (std::same_as<Builder, UltraCircuitBuilder>) {
+            size_t num_constraints = 0;
+            for (const auto& run : this->runs) {
+                num_constraints += run.size();
+            }
+            if (!parallel || num_constraints < 2) {
+                return;
+            }
+            const size_t chunk_size = (num_constraints + get_num_cpus() - 1) / get_num_cpus();
+            for (size_t i = 0; i < this->runs.size(); ++i) {
+                for (size_t start = 0; start < this->runs[i].size(); start += chunk_size) {
+                    chunks.push_back({ i, start, std::min(start + chunk_size, this->runs[i].size()) });
+                }
+            }
+            // The multi-tables are created on first use, which must not happen on several threads at once
+            plookup::create_table(plookup::MultiTableId::HONK_DUMMY_MULTI);
+
+            base = builder.create_sub_builder();
+            sub_builders.resize(chunks.size());
+            parallel_for(chunks.size(), [&](size_t i) {
+                sub_builders[i] = base;
+                add_chunk(sub_builders[i], chunks[i]);
+            });
+        }
+    }
+
+    void add(Builder& builder, size_t run_index)
+    {
+        if (chunks.empty()) {
+            add_chunk(builder, { run_index, 0, runs[run_index].size() });
+            return;
+        }
+        if constexpr (std::same_as<Builder, UltraCircuitBuilder>) {
+            for (size_t i = 0; i < chunks.size(); ++i) {
+                if (chunks[i].run != run_index) {
+                    continue;
+                }
+                if (!builder.splice_sub_builder(sub_builders[i], base)) {
+                    add_chunk(builder, chunks[i]);
+                }
+                sub_builders[i] = Builder{};
+            }
+        }
+    }
+
+  private:
+    struct Chunk {
+        size_t run;
+        size_t start;
+        size_t end;
+    };
+
+    void add_chunk(Builder& builder, Chunk const& chunk) const
+    {
+        for (size_t i = chunk.start; i < chunk.end; ++i) {
+            runs[chunk.run][i](builder);
+        }
+    }
+
+    std::vector<std::vector<Constraint>> runs;
+    std::vector<Chunk> chunks;
+    Builder base;
+    std::vector<Builder> sub_builders;
+};
+
+} // namespace
+
 template <typename Builder>
-void build_constraints(Builder& builder, AcirFormat const& constraint_system, bool has_valid_witness_assignments)
+void build_constraints(Builder& builder,
+                       AcirFormat const& constraint_system,
+                       bool has_valid_witness_assignments,
+                       bool parallel_black_boxes)
 {
     // Add arithmetic gates
     for (const auto& constraint : constraint_system.constraints) {
@@ -24,10 +120,32 @@ void build_constraints(Builder& builder, AcirFormat const& constraint_system, bo
         builder.create_range_constraint(constraint.witness, constraint.num_bits, "");
     }
 
-    // Add sha256 constraints
+    // The hash constraints are independent of one another, and can be built in parallel
+    std::vector<std::function<void(Builder&)>> sha256_constraints;
     for (const auto& constraint : constraint_system.sha256_constraints) {
-        create_sha256_constraints(builder, constraint);
+        sha256_constraints.emplace_back([&](Builder& builder) { create_sha256_constraints(builder, constraint); });
+    }
+    std::vector<std::function<void(Builder&)>> hash_constraints;
+    for (const auto& constraint : constraint_system.blake2s_constraints) {
+        hash_constraints.emplace_back([&](Builder& builder) { create_blake2s_constraints(builder, constraint); });
+    }
+    for (const auto& constraint : constraint_system.blake3_constraints) {
+        hash_constraints.emplace_back([&](Builder& builder) { create_blake3_constraints(builder, constraint); });
     }
+    for (const auto& constraint : constraint_system.keccak_constraints) {
+        hash_constraints.emplace_back([&](Builder& builder) { create_keccak_constraints(builder, constraint); });
+    }
+    for (const auto& constraint : constraint_system.keccak_var_constraints) {
+        hash_constraints.emplace_back([&](Builder& builder) { create_keccak_var_constraints(builder, constraint); });
+    }
+    for (const auto& constraint : constraint_system.keccak_permutations) {
+        hash_constraints.emplace_back([&](Builder& builder) { create_keccak_permutations(builder, constraint); });
+    }
+    BlackBoxRuns<Builder> hashes(
+        builder, { std::move(sha256_constraints), std::move(hash_constraints) }, parallel_black_boxes);
+
+    // Add sha256 constraints
+    hashes.add(builder, 0);
 
     // Add schnorr constraints
     for (const auto& constraint : constraint_system.schnorr_constraints) {
@@ -44,26 +162,8 @@ void build_constraints(Builder& builder, AcirFormat const& constraint_system, bo
         create_ecdsa_r1_verify_constraints(builder, constraint, has_valid_witness_assignments);
     }
 
-    // Add blake2s constraints
-    for (const auto& constraint : constraint_system.blake2s_constraints) {
-        create_blake2s_constraints(builder, constraint);
-    }
-
-    // Add blake3 constraints
-    for (const auto& constraint : constraint_system.blake3_constraints) {
-        create_blake3_constraints(builder, constraint);
-    }
-
-    // Add keccak constraints
-    for (const auto& constraint : constraint_system.keccak_constraints) {
-        create_keccak_constraints(builder, constraint);
-    }
-    for (const auto& constraint : constraint_system.keccak_var_constraints) {
-        create_keccak_var_constraints(builder, constraint);
-    }
-    for (const auto& constraint : constraint_system.keccak_permutations) {
-        create_keccak_permutations(builder, constraint);
-    }
+    // Add blake2s, blake3 and keccak constraints
+    hashes.add(builder, 1);
 
     // Add pedersen constraints
     for (const auto& constraint : constraint_system.pedersen_constraints) {
@@ -181,6 +281,61 @@ void build_constraints(Builder& builder, AcirFormat const& constraint_system, bo
     }
 }
 
+namespace {
+// Sizes of the circuits built in this process, by get_size_profile_key
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex size_profiles_mutex;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unordered_map<uint64_t, CircuitSizeProfile> size_profiles;
+} // namespace
+
+uint64_t get_size_profile_key(AcirFormat const& constraint_system)
+{
+    const std::array<size_t, 22> sizes{ constraint_system.varnum,
+                                        constraint_system.public_inputs.size(),
+                                        constraint_system.logic_constraints.size(),
+                                        constraint_system.range_constraints.size(),
+                                        constraint_system.sha256_constraints.size(),
+                                        constraint_system.schnorr_constraints.size(),
+                                        constraint_system.ecdsa_k1_constraints.size(),
+                                        constraint_system.ecdsa_r1_constraints.size(),
+                                        constraint_system.blake2s_constraints.size(),
+                                        constraint_system.blake3_constraints.size(),
+                                        constraint_system.keccak_constraints.size(),
+                                        constraint_system.keccak_var_constraints.size(),
+                                        constraint_system.keccak_permutations.size(),
+                                        constraint_system.pedersen_constraints.size(),
+                                        constraint_system.pedersen_hash_constraints.size(),
+                                        constraint_system.fixed_base_scalar_mul_constraints.size(),
+                                        constraint_system.ec_add_constraints.size(),
+                                        constraint_system.recursion_constraints.size(),
+                                        constraint_system.bigint_from_le_bytes_constraints.size(),
+                                        constraint_system.bigint_operations.size(),
+                                        constraint_system.constraints.size(),
+                                        constraint_system.block_constraints.size() };
+    // 64-bit FNV-1a over the sizes
+    uint64_t key = 0xcbf29ce484222325ULL;
+    for (const size_t size : sizes) {
+        key = (key ^ static_cast<uint64_t>(size)) * 0x100000001b3ULL;
+    }
+    return key;
+}
+
+CircuitSizeProfile get_size_profile(uint64_t key)
+{
+    std::unique_lock<std::mutex> lock(size_profiles_mutex);
+    auto it = size_profiles.find(key);
+    return it == size_profiles.end() ? CircuitSizeProfile{} : it->second;
+}
+
+void record_size_profile(uint64_t key, CircuitSizeProfile const& profile)
+{
+    std::unique_lock<std::mutex> lock(size_profiles_mutex);
+    auto& recorded = size_profiles[key];
+    recorded.num_gates = std::max(recorded.num_gates, profile.num_gates);
+    recorded.num_variables = std::max(recorded.num_variables, profile.num_variables);
+}
+
 /**
  * @brief Create a circuit from acir constraints and optionally a witness
  *
@@ -188,22 +343,35 @@ void build_constraints(Builder& builder, AcirFormat const& constraint_system, bo
  * @param constraint_system
  * @param size_hint
  * @param witness
+ * @param parallel_black_boxes build the hash constraints on separate threads (UltraCircuitBuilder only), which gives
+ * the same circuit
+ * @param arena an arena to allocate the builder's variables, wires and selectors from, which must outlive the builder
  * @return Builder
+ *
+ * @note If the sizes of a circuit with the same key have been recorded with record_size_profile, the builder reserves
+ * them instead of size_hint.
  */
 template <typename Builder>
-Builder create_circuit(const AcirFormat& constraint_system, size_t size_hint, WitnessVector const& witness)
+Builder create_circuit(const AcirFormat& constraint_system,
+                       size_t size_hint,
+                       WitnessVector const& witness,
+                       bool parallel_black_boxes,
+                       Arena* arena)
 {
-    Builder builder{ size_hint, witness, constraint_system.public_inputs, constraint_system.varnum };
+    const CircuitSizeProfile profile = get_size_profile(get_size_profile_key(constraint_system));
+    Builder builder{ size_hint, witness, constraint_system.public_inputs, constraint_system.varnum, profile, arena };
 
     bool has_valid_witness_assignments = !witness.empty();
-    build_constraints(builder, constraint_system, has_valid_witness_assignments);
+    build_constraints(builder, constraint_system, has_valid_witness_assignments, parallel_black_boxes);
 
     return builder;
 }
 
 template UltraCircuitBuilder create_circuit<UltraCircuitBuilder>(const AcirFormat& constraint_system,
                                                                  size_t size_hint,
-                                                                 WitnessVector const& witness);
-template void build_constraints<GoblinUltraCircuitBuilder>(GoblinUltraCircuitBuilder&, AcirFormat const&, bool);
+                                                                 WitnessVector const& witness,
+                                                                 bool parallel_black_boxes,
+                                                                 Arena* arena);
+template void build_constraints<GoblinUltraCircuitBuilder>(GoblinUltraCircuitBuilder&, AcirFormat const&, bool, bool);
 
 } // namespace acir_format
@@ -81,10 +81,32 @@ struct AcirFormat {
 
 using WitnessVector = std::vector<fr, ContainerSlabAllocator<fr>>;
 
+/**
+ * @brief A key for the sizes the builder of a constraint system grows to: the number of witnesses and public inputs and
+ * the number of constraints of each kind
+ * @details Constraint systems of the same shape, e.g. differing only in the length of a hash input, share a key. That
+ * only affects how well the recorded sizes fit, as they are a hint.
+ */
+uint64_t get_size_profile_key(AcirFormat const& constraint_system);
+
+/**
+ * @brief The largest sizes recorded under a key in this process, or zeros if none were
+ */
+CircuitSizeProfile get_size_profile(uint64_t key);
+
+void record_size_profile(uint64_t key, CircuitSizeProfile const& profile);
+
 template <typename Builder = UltraCircuitBuilder>
-Builder create_circuit(const AcirFormat& constraint_system, size_t size_hint = 0, WitnessVector const& witness = {});
+Builder create_circuit(const AcirFormat& constraint_system,
+                       size_t size_hint = 0,
+                       WitnessVector const& witness = {},
+                       bool parallel_black_boxes = false,
+                       Arena* arena = nullptr);
 
 template <typename Builder>
-void build_constraints(Builder& builder, AcirFormat const& constraint_system, bool has_valid_witness_assignments);
+void build_constraints(Builder& builder,
+                       AcirFormat const& constraint_system,
+                       bool has_valid_witness_assignments,
+                       bool parallel_black_boxes = false);
 
 } // namespace acir_format
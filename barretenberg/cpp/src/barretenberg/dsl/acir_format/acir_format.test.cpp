@@ -3,6 +3,8 @@
 
 #include "acir_format.hpp"
 #include "barretenberg/common/streams.hpp"
+#include "barretenberg/crypto/blake2s/blake2s.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
 #include "barretenberg/serialize/test_helper.hpp"
 #include "ecdsa_secp256k1.hpp"
@@ -487,3 +489,90 @@ TEST_F(AcirFormatTests, TestKeccakPermutation)
 
     EXPECT_EQ(verifier.verify_proof(proof), true);
 }
+
+TEST_F(AcirFormatTests, ParallelHashConstraintsGiveTheSameCircuit)
+{
+    WitnessVector witness;
+    const auto add_witnesses = [&](auto const& bytes) {
+        std::vector<uint32_t> indices;
+        for (const auto byte : bytes) {
+            indices.emplace_back(static_cast<uint32_t>(witness.size()));
+            witness.emplace_back(byte);
+        }
+        return indices;
+    };
+    std::vector<std::vector<uint8_t>> messages;
+    std::vector<std::vector<uint32_t>> message_witnesses;
+    for (uint8_t i = 0; i < 6; ++i) {
+        messages.push_back({ i, 1, 2, 3, 4, 5, 6, static_cast<uint8_t>(3 * i) });
+        message_witnesses.emplace_back(add_witnesses(messages.back()));
+    }
+
+    std::vector<RangeConstraint> range_constraints;
+    for (const auto index : message_witnesses[0]) {
+        range_constraints.push_back({ .witness = index, .num_bits = 8 });
+    }
+    std::vector<Sha256Constraint> sha256_constraints;
+    std::vector<std::vector<uint8_t>> sha256_hashes;
+    for (size_t i = 0; i < 4; ++i) {
+        Sha256Constraint constraint;
+        for (const auto index : message_witnesses[i]) {
+            constraint.inputs.push_back({ .witness = index, .num_bits = 8 });
+        }
+        const auto hash = sha256::sha256(messages[i]);
+        sha256_hashes.emplace_back(hash.begin(), hash.end());
+        constraint.result = add_witnesses(hash);
+        sha256_constraints.push_back(constraint);
+    }
+    // Besides independent messages, hash a message that a sha256 constraint hashes too and the output of another sha256
+    // constraint, which both copy constrain witnesses the sha256 constraints copy constrain, and are built sequentially
+    std::vector<Blake2sConstraint> blake2s_constraints;
+    for (const auto& [message, indices] : { std::pair{ messages[1], message_witnesses[1] },
+                                            std::pair{ messages[4], message_witnesses[4] },
+                                            std::pair{ messages[5], message_witnesses[5] },
+                                            std::pair{ sha256_hashes[2], sha256_constraints[2].result } }) {
+        Blake2sConstraint constraint;
+        for (const auto index : indices) {
+            constraint.inputs.push_back({ .witness = index, .num_bits = 8 });
+        }
+        constraint.result = add_witnesses(bb::crypto::blake2s(message));
+        blake2s_constraints.push_back(constraint);
+    }
+
+    AcirFormat constraint_system{ .varnum = static_cast<uint32_t>(witness.size()),
+                                  .public_inputs = {},
+                                  .logic_constraints = {},
+                                  .range_constraints = range_constraints,
+                                  .sha256_constraints = sha256_constraints,
+                                  .schnorr_constraints = {},
+                                  .ecdsa_k1_constraints = {},
+                                  .ecdsa_r1_constraints = {},
+                                  .blake2s_constraints = blake2s_constraints,
+                                  .blake3_constraints = {},
+                                  .keccak_constraints = {},
+                                  .keccak_var_constraints = {},
+                                  .keccak_permutations = {},
+                                  .pedersen_constraints = {},
+                                  .pedersen_hash_constraints = {},
+                                  .fixed_base_scalar_mul_constraints = {},
+                                  .ec_add_constraints = {},
+                                  .recursion_constraints = {},
+                                  .bigint_from_le_bytes_constraints = {},
+                                  .bigint_operations = {},
+                                  .constraints = {},
+                                  .block_constraints = {} };
+
+    auto builder = create_circuit(constraint_system, /*size_hint=*/0, witness);
+    auto parallel_builder =
+        create_circuit(constraint_system, /*size_hint=*/0, witness, /*parallel_black_boxes=*/true);
+
+    auto state = UltraCircuitBuilder::CircuitDataBackup::store_full_state(builder);
+    EXPECT_TRUE(state.is_same_state(parallel_builder));
+    ASSERT_EQ(parallel_builder.lookup_tables.size(), builder.lookup_tables.size());
+    for (size_t i = 0; i < builder.lookup_tables.size(); ++i) {
+        EXPECT_EQ(parallel_builder.lookup_tables[i].id, builder.lookup_tables[i].id);
+        EXPECT_EQ(parallel_builder.lookup_tables[i].lookup_gates.size(), builder.lookup_tables[i].lookup_gates.size());
+    }
+    EXPECT_FALSE(parallel_builder.failed());
+    EXPECT_TRUE(parallel_builder.check_circuit());
+}
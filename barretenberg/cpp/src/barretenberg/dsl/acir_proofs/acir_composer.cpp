@@ -27,7 +27,11 @@ template <typename Builder>
 void AcirComposer::create_circuit(acir_format::AcirFormat& constraint_system, WitnessVector const& witness)
 {
     vinfo("building circuit...");
-    builder_ = acir_format::create_circuit<Builder>(constraint_system, size_hint_, witness);
+    // Release the previous circuit before building over its memory
+    builder_ = Builder{};
+    arena_->reset();
+    size_profile_key_ = acir_format::get_size_profile_key(constraint_system);
+    builder_ = acir_format::create_circuit<Builder>(constraint_system, size_hint_, witness, false, arena_.get());
     vinfo("gates: ", builder_.get_total_circuit_size());
 }
 
@@ -36,6 +40,8 @@ std::shared_ptr<bb::plonk::proving_key> AcirComposer::init_proving_key()
     acir_format::Composer composer;
     vinfo("computing proving key...");
     proving_key_ = composer.compute_proving_key(builder_);
+    // The next build of the circuit reserves the sizes it has reached with finalization
+    acir_format::record_size_profile(size_profile_key_, builder_.get_size_profile());
     return proving_key_;
 }
 
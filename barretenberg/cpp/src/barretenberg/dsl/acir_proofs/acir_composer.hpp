@@ -38,7 +38,10 @@ class AcirComposer {
     std::vector<bb::fr> serialize_verification_key_into_fields();
 
   private:
+    // Holds the builder's vectors, and is reused by the next circuit built
+    std::unique_ptr<bb::Arena> arena_ = std::make_unique<bb::Arena>();
     acir_format::Builder builder_;
+    uint64_t size_profile_key_ = 0;
     size_t size_hint_;
     std::shared_ptr<bb::plonk::proving_key> proving_key_;
     std::shared_ptr<bb::plonk::verification_key> verification_key_;
@@ -436,5 +436,81 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+/**
+ * The following compare the elementwise scalar loops used by polynomial-wide operations with the bulk field methods,
+ * which dispatch to the multi-lane (AVX-512 IFMA) kernels when the CPU supports them.
+ */
+void elementwise_mul_bench(State& state) noexcept
+{
+    std::vector<fr> lhs(oldx);
+    uint64_t clocks = 0;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        uint64_t before = rdtsc();
+        for (size_t i = 0; i < NUM_POINTS; ++i) {
+            lhs[i] *= oldy[i];
+        }
+        clocks += (rdtsc() - before);
+        ++count;
+        DoNotOptimize(lhs[0]);
+    }
+    double average = static_cast<double>(clocks) / (static_cast<double>(count) * static_cast<double>(NUM_POINTS));
+    std::cout << "elementwise mul clocks per operation = " << average << std::endl;
+}
+BENCHMARK(elementwise_mul_bench);
+
+void batch_mul_bench(State& state) noexcept
+{
+    std::vector<fr> lhs(oldx);
+    uint64_t clocks = 0;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        uint64_t before = rdtsc();
+        fr::batch_mul(lhs, oldy);
+        clocks += (rdtsc() - before);
+        ++count;
+        DoNotOptimize(lhs[0]);
+    }
+    double average = static_cast<double>(clocks) / (static_cast<double>(count) * static_cast<double>(NUM_POINTS));
+    std::cout << "batch mul clocks per operation = " << average << std::endl;
+}
+BENCHMARK(batch_mul_bench);
+
+void elementwise_add_scaled_bench(State& state) noexcept
+{
+    std::vector<fr> acc(oldx);
+    uint64_t clocks = 0;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        uint64_t before = rdtsc();
+        for (size_t i = 0; i < NUM_POINTS; ++i) {
+            acc[i] += oldy[i] * accz;
+        }
+        clocks += (rdtsc() - before);
+        ++count;
+        DoNotOptimize(acc[0]);
+    }
+    double average = static_cast<double>(clocks) / (static_cast<double>(count) * static_cast<double>(NUM_POINTS));
+    std::cout << "elementwise add scaled clocks per operation = " << average << std::endl;
+}
+BENCHMARK(elementwise_add_scaled_bench);
+
+void batch_add_scaled_bench(State& state) noexcept
+{
+    std::vector<fr> acc(oldx);
+    uint64_t clocks = 0;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        uint64_t before = rdtsc();
+        fr::batch_add_scaled(acc, oldy, accz);
+        clocks += (rdtsc() - before);
+        ++count;
+        DoNotOptimize(acc[0]);
+    }
+    double average = static_cast<double>(clocks) / (static_cast<double>(count) * static_cast<double>(NUM_POINTS));
+    std::cout << "batch add scaled clocks per operation = " << average << std::endl;
+}
+BENCHMARK(batch_add_scaled_bench);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
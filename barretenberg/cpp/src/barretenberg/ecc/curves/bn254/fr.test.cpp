@@ -360,6 +360,98 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, ParallelBatchInvert)
+{
+    // large enough to be split into several chunks
+    constexpr size_t n = 1 << 14;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 1000 == 7) ? fr::zero() : fr::random_element();
+    }
+
+    auto inverses = coeffs;
+    fr::parallel_batch_invert(inverses);
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_TRUE(inverses[i].is_zero());
+        } else {
+            EXPECT_EQ(inverses[i] * coeffs[i], fr::one());
+        }
+    }
+
+    // without zero handling
+    for (auto& coeff : coeffs) {
+        if (coeff.is_zero()) {
+            coeff = fr::random_element();
+        }
+    }
+    inverses = coeffs;
+    fr::parallel_batch_invert(inverses, /*skip_zeroes=*/false);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(inverses[i] * coeffs[i], fr::one());
+    }
+}
+
+// Inputs include non-canonical representatives in [p, 2p) and a length that is not a multiple of the kernel width
+std::vector<fr> get_batch_test_inputs(size_t n)
+{
+    std::vector<fr> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = fr::random_element();
+        if (i % 3 == 0) {
+            values[i] = values[i].reduce_once() + fr{ fr::modulus.data[0], fr::modulus.data[1], fr::modulus.data[2],
+                                                      fr::modulus.data[3] };
+        }
+    }
+    return values;
+}
+
+TEST(fr, BatchMul)
+{
+    constexpr size_t n = 1027;
+    auto lhs = get_batch_test_inputs(n);
+    auto rhs = get_batch_test_inputs(n);
+    fr scalar = fr::random_element();
+
+    std::vector<fr> expected_products(n);
+    std::vector<fr> expected_scaled(n);
+    for (size_t i = 0; i < n; ++i) {
+        expected_products[i] = lhs[i] * rhs[i];
+        expected_scaled[i] = lhs[i] * scalar;
+    }
+
+    auto products = lhs;
+    fr::batch_mul(products, rhs);
+    auto scaled = lhs;
+    fr::batch_mul(scaled, scalar);
+
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], expected_products[i]);
+        EXPECT_EQ(scaled[i], expected_scaled[i]);
+    }
+}
+
+TEST(fr, BatchAddScaled)
+{
+    constexpr size_t n = 1027;
+    auto acc = get_batch_test_inputs(n);
+    auto other = get_batch_test_inputs(n);
+    fr scalar = fr::random_element();
+
+    std::vector<fr> expected(n);
+    for (size_t i = 0; i < n; ++i) {
+        expected[i] = acc[i] + other[i] * scalar;
+    }
+
+    fr::batch_add_scaled(acc, other, scalar);
+
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(acc[i], expected[i]);
+        // the result must stay within the coarse range [0, 2p) expected by the scalar arithmetic
+        EXPECT_LT(uint256_t(acc[i].data[0], acc[i].data[1], acc[i].data[2], acc[i].data[3]), fr::modulus + fr::modulus);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
@@ -1,7 +1,65 @@
 // TODO: Delete this cbind once funcs working in root cbind of ecc module.
-#include "barretenberg/common/wasm_export.hpp"
+#include "c_bind.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "grumpkin.hpp"
 
+namespace {
+
+using affine_element = grumpkin::g1::affine_element;
+using element = grumpkin::g1::element;
+
+constexpr size_t POINT_SIZE = 64;
+constexpr size_t SCALAR_SIZE = 32;
+
+/**
+ * @brief Deserialise `num_points` points from `point_buf` into `points`, across threads
+ */
+void read_points(uint8_t const* point_buf, size_t num_points, affine_element* points)
+{
+    run_loop_in_parallel_if_effective(
+        num_points,
+        [point_buf, points](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                points[i] = from_buffer<affine_element>(point_buf + (i * POINT_SIZE));
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/2);
+}
+
+std::vector<grumpkin::fr> read_scalars(uint8_t const* scalar_buf, size_t num_scalars)
+{
+    std::vector<grumpkin::fr> scalars(num_scalars);
+    run_loop_in_parallel_if_effective(
+        num_scalars,
+        [scalar_buf, &scalars](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                scalars[i] = from_buffer<grumpkin::fr>(scalar_buf + (i * SCALAR_SIZE));
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/1);
+    return scalars;
+}
+
+void write_points(std::span<const affine_element> points, uint8_t* result)
+{
+    using serialize::write;
+    run_loop_in_parallel_if_effective(
+        points.size(),
+        [points, result](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                uint8_t* result_ptr = result + (i * POINT_SIZE);
+                write(result_ptr, points[i]);
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/2);
+}
+
+} // namespace
+
 // Silencing warnings about reserved identifiers. Fixing would break downstream code that calls our WASM API.
 // NOLINTBEGIN(cert-dcl37-c, cert-dcl51-cpp, bugprone-reserved-identifier)
 WASM_EXPORT void ecc_grumpkin__mul(uint8_t const* point_buf, uint8_t const* scalar_buf, uint8_t* result)
@@ -19,19 +77,67 @@ WASM_EXPORT void ecc_grumpkin__batch_mul(uint8_t const* point_buf,
                                          uint32_t num_points,
                                          uint8_t* result)
 {
-    using serialize::write;
-    std::vector<grumpkin::g1::affine_element> points;
-    points.reserve(num_points);
-    for (size_t i = 0; i < num_points; ++i) {
-        points.emplace_back(from_buffer<grumpkin::g1::affine_element>(point_buf + (i * 64)));
-    }
+    std::vector<affine_element> points(num_points);
+    read_points(point_buf, num_points, points.data());
     auto scalar = from_buffer<grumpkin::fr>(scalar_buf);
-    auto output = grumpkin::g1::element::batch_mul_with_endomorphism(points, scalar);
+    auto output = element::batch_mul_with_endomorphism(points, scalar);
+    write_points(output, result);
+}
+
+// multiplies each point by its own scalar. Returns a vector of points (this is NOT a multi-exponentiation)
+WASM_EXPORT void ecc_grumpkin__batch_mul_scalars(uint8_t const* point_buf,
+                                                 uint8_t const* scalar_buf,
+                                                 uint32_t num_points,
+                                                 uint8_t* result)
+{
+    std::vector<affine_element> points(num_points);
+    read_points(point_buf, num_points, points.data());
+    auto scalars = read_scalars(scalar_buf, num_points);
+    std::vector<element> products(num_points);
+    run_loop_in_parallel_if_effective(
+        num_points,
+        [&points, &scalars, &products](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                products[i] = element(points[i]) * scalars[i];
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/0,
+        /*finite_field_inversions_per_iteration=*/0,
+        /*group_element_additions_per_iteration=*/0,
+        /*group_element_doublings_per_iteration=*/0,
+        /*scalar_multiplications_per_iteration=*/1);
+    // Normalises all the products with a single (parallel) batch inversion
+    element::batch_normalize(products.data(), num_points);
     for (size_t i = 0; i < num_points; ++i) {
-        grumpkin::g1::affine_element r = output[i];
-        uint8_t* result_ptr = result + (i * 64);
-        write(result_ptr, r);
+        points[i] = affine_element(products[i].x, products[i].y);
     }
+    write_points(points, result);
+}
+
+// computes the multi-scalar multiplication sum_i scalars[i] * points[i] with pippenger. Returns a single point
+WASM_EXPORT void ecc_grumpkin__msm(uint8_t const* point_buf,
+                                   uint8_t const* scalar_buf,
+                                   uint32_t num_points,
+                                   uint8_t* result)
+{
+    using serialize::write;
+    using Curve = bb::curve::Grumpkin;
+    using namespace bb::scalar_multiplication;
+    if (num_points == 0) {
+        affine_element r{ grumpkin::fq::zero(), grumpkin::fq::zero() };
+        r.self_set_infinity();
+        write(result, r);
+        return;
+    }
+    // Pippenger works on the points interleaved with their endomorphism images, which are filled in in place
+    std::vector<affine_element> point_table(static_cast<size_t>(num_points) * 2);
+    read_points(point_buf, num_points, point_table.data());
+    generate_pippenger_point_table<Curve>(point_table.data(), point_table.data(), num_points);
+    auto scalars = read_scalars(scalar_buf, num_points);
+    pippenger_runtime_state<Curve> state(num_points);
+    affine_element r = pippenger<Curve>(scalars.data(), point_table.data(), num_points, state);
+    write(result, r);
 }
 
 WASM_EXPORT void ecc_grumpkin__get_random_scalar_mod_circuit_modulus(uint8_t* result)
@@ -0,0 +1,28 @@
+#pragma once
+#include "barretenberg/common/wasm_export.hpp"
+#include <cstdint>
+
+// Silencing warnings about reserved identifiers. Fixing would break downstream code that calls our WASM API.
+// NOLINTBEGIN(cert-dcl37-c, cert-dcl51-cpp, bugprone-reserved-identifier)
+WASM_EXPORT void ecc_grumpkin__mul(uint8_t const* point_buf, uint8_t const* scalar_buf, uint8_t* result);
+
+// Points are serialised as 64 bytes and scalars as 32 bytes, packed one after another in each buffer
+WASM_EXPORT void ecc_grumpkin__batch_mul(uint8_t const* point_buf,
+                                         uint8_t const* scalar_buf,
+                                         uint32_t num_points,
+                                         uint8_t* result);
+
+WASM_EXPORT void ecc_grumpkin__batch_mul_scalars(uint8_t const* point_buf,
+                                                 uint8_t const* scalar_buf,
+                                                 uint32_t num_points,
+                                                 uint8_t* result);
+
+WASM_EXPORT void ecc_grumpkin__msm(uint8_t const* point_buf,
+                                   uint8_t const* scalar_buf,
+                                   uint32_t num_points,
+                                   uint8_t* result);
+
+WASM_EXPORT void ecc_grumpkin__get_random_scalar_mod_circuit_modulus(uint8_t* result);
+
+WASM_EXPORT void ecc_grumpkin__reduce512_buffer_mod_circuit_modulus(uint8_t* input, uint8_t* result);
+// NOLINTEND(cert-dcl37-c, cert-dcl51-cpp, bugprone-reserved-identifier)
@@ -1,3 +1,5 @@
+#include "barretenberg/common/thread.hpp"
+#include "c_bind.hpp"
 #include "grumpkin.hpp"
 #include <chrono>
 #include <gtest/gtest.h>
@@ -312,6 +314,54 @@ TEST(grumpkin, BatchMul)
         EXPECT_EQ(result[i].y, expected[i].y);
     }
 }
+TEST(grumpkin, CBindBatchMulAndMsm)
+{
+    using serialize::write;
+    // Enough points for the MSM to take the pippenger path rather than the naive one
+    const size_t num_points = get_num_cpus_pow2() * 8 + 3;
+    std::vector<grumpkin::g1::affine_element> points(num_points);
+    std::vector<grumpkin::fr> scalars(num_points);
+    std::vector<uint8_t> point_buf(num_points * 64);
+    std::vector<uint8_t> scalar_buf(num_points * 32);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = grumpkin::g1::element::random_element();
+        scalars[i] = grumpkin::fr::random_element();
+        uint8_t* point_ptr = &point_buf[i * 64];
+        uint8_t* scalar_ptr = &scalar_buf[i * 32];
+        write(point_ptr, points[i]);
+        write(scalar_ptr, scalars[i]);
+    }
+    std::vector<uint8_t> result_buf(num_points * 64);
+
+    ecc_grumpkin__batch_mul(point_buf.data(), scalar_buf.data(), static_cast<uint32_t>(num_points), result_buf.data());
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(from_buffer<grumpkin::g1::affine_element>(&result_buf[i * 64]),
+                  grumpkin::g1::affine_element(points[i] * scalars[0]));
+    }
+
+    ecc_grumpkin__batch_mul_scalars(
+        point_buf.data(), scalar_buf.data(), static_cast<uint32_t>(num_points), result_buf.data());
+    grumpkin::g1::element expected = grumpkin::g1::element::infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(from_buffer<grumpkin::g1::affine_element>(&result_buf[i * 64]),
+                  grumpkin::g1::affine_element(points[i] * scalars[i]));
+        expected += points[i] * scalars[i];
+    }
+
+    std::vector<uint8_t> msm_buf(64);
+    ecc_grumpkin__msm(point_buf.data(), scalar_buf.data(), static_cast<uint32_t>(num_points), msm_buf.data());
+    EXPECT_EQ(from_buffer<grumpkin::g1::affine_element>(msm_buf.data()), grumpkin::g1::affine_element(expected));
+
+    // The empty MSM is the point at infinity, serialised the same way as by ecc_grumpkin__mul
+    std::vector<uint8_t> infinity_buf(64);
+    uint8_t* infinity_ptr = infinity_buf.data();
+    grumpkin::g1::affine_element infinity{ grumpkin::fq::zero(), grumpkin::fq::zero() };
+    infinity.self_set_infinity();
+    write(infinity_ptr, infinity);
+    ecc_grumpkin__msm(point_buf.data(), scalar_buf.data(), 0, msm_buf.data());
+    EXPECT_EQ(msm_buf, infinity_buf);
+}
+
 // Checks for "bad points" in terms of sharing a y-coordinate as explained here:
 // https://github.com/AztecProtocol/aztec2-internal/issues/437
 TEST(grumpkin, BadPoints)
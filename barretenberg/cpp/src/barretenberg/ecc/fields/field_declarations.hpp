@@ -252,6 +252,26 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief Montgomery batch inversion split across threads: each thread accumulates the prefix products of its own
+     * chunk and performs a single inversion
+     *
+     * @param skip_zeroes If true, zero elements are left untouched (as in batch_invert). If false, the caller
+     * guarantees that there are no zero elements and the per-element zero checks are skipped.
+     */
+    static void parallel_batch_invert(std::span<field> coeffs, bool skip_zeroes = true) noexcept;
+
+    /**
+     * @brief Elementwise bulk multiplication: r[i] *= other[i] (resp. r[i] *= scalar)
+     * @details Uses the multi-lane kernels in field_vectorized.hpp where the CPU and the modulus support them, and
+     * scalar arithmetic otherwise (and for any leftover elements).
+     */
+    static void batch_mul(std::span<field> r, std::span<const field> other) noexcept;
+    static void batch_mul(std::span<field> r, const field& scalar) noexcept;
+    /**
+     * @brief Elementwise bulk multiply-accumulate: r[i] += other[i] * scalar
+     */
+    static void batch_add_scaled(std::span<field> r, std::span<const field> other, const field& scalar) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
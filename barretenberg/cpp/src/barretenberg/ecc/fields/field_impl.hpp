@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -9,6 +10,7 @@
 #include <vector>
 
 #include "./field_declarations.hpp"
+#include "./field_vectorized.hpp"
 
 namespace bb {
 
@@ -425,6 +427,107 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+template <class T> void field<T>::parallel_batch_invert(std::span<field> coeffs, const bool skip_zeroes) noexcept
+{
+    // Every chunk pays for one inversion (a few hundred multiplications); keep chunks large enough to amortise it
+    constexpr size_t MIN_ELEMENTS_PER_CHUNK = 1 << 10;
+
+    const auto invert_chunk = [skip_zeroes](std::span<field> chunk) {
+        if (skip_zeroes) {
+            batch_invert(chunk);
+            return;
+        }
+        const size_t n = chunk.size();
+        auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
+        auto* temporaries = temporaries_ptr.get();
+        field accumulator = one();
+        for (size_t i = 0; i < n; ++i) {
+            temporaries[i] = accumulator;
+            accumulator *= chunk[i];
+        }
+        accumulator = accumulator.invert();
+        for (size_t i = n - 1; i < n; --i) {
+            const field inverse = accumulator * temporaries[i];
+            accumulator *= chunk[i];
+            chunk[i] = inverse;
+        }
+    };
+
+    const size_t num_chunks = thread_utils::calculate_num_threads(coeffs.size(), MIN_ELEMENTS_PER_CHUNK);
+    if (num_chunks == 1) {
+        invert_chunk(coeffs);
+        return;
+    }
+    const size_t chunk_size = coeffs.size() / num_chunks;
+    parallel_for(num_chunks, [&](size_t j) {
+        const size_t start = j * chunk_size;
+        const size_t end = (j == num_chunks - 1) ? coeffs.size() : start + chunk_size;
+        invert_chunk(coeffs.subspan(start, end - start));
+    });
+}
+
+namespace detail {
+/**
+ * @brief The vectorized kernels require the coarse [0, 2p) representation used for moduli < 2^254
+ */
+template <class T>
+constexpr bool supports_vectorized_kernels =
+    (T::modulus_3 < 0x4000000000000000ULL) && !(T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0);
+
+template <class T>
+constexpr field_vectorized::MontgomeryParams vectorized_params{
+    { T::modulus_0, T::modulus_1, T::modulus_2, T::modulus_3 }, T::r_inv
+};
+} // namespace detail
+
+template <class T> void field<T>::batch_mul(std::span<field> r, std::span<const field> other) noexcept
+{
+    ASSERT(r.size() == other.size());
+    size_t num_processed = 0;
+    if constexpr (detail::supports_vectorized_kernels<T>) {
+        num_processed = field_vectorized::mul(reinterpret_cast<uint64_t*>(r.data()),
+                                              reinterpret_cast<const uint64_t*>(r.data()),
+                                              reinterpret_cast<const uint64_t*>(other.data()),
+                                              r.size(),
+                                              detail::vectorized_params<T>);
+    }
+    for (size_t i = num_processed; i < r.size(); ++i) {
+        r[i] *= other[i];
+    }
+}
+
+template <class T> void field<T>::batch_mul(std::span<field> r, const field& scalar) noexcept
+{
+    size_t num_processed = 0;
+    if constexpr (detail::supports_vectorized_kernels<T>) {
+        num_processed = field_vectorized::mul_by_scalar(reinterpret_cast<uint64_t*>(r.data()),
+                                                        reinterpret_cast<const uint64_t*>(r.data()),
+                                                        &scalar.data[0],
+                                                        r.size(),
+                                                        detail::vectorized_params<T>);
+    }
+    for (size_t i = num_processed; i < r.size(); ++i) {
+        r[i] *= scalar;
+    }
+}
+
+template <class T>
+void field<T>::batch_add_scaled(std::span<field> r, std::span<const field> other, const field& scalar) noexcept
+{
+    ASSERT(r.size() == other.size());
+    size_t num_processed = 0;
+    if constexpr (detail::supports_vectorized_kernels<T>) {
+        num_processed = field_vectorized::add_scaled(reinterpret_cast<uint64_t*>(r.data()),
+                                                     reinterpret_cast<const uint64_t*>(other.data()),
+                                                     &scalar.data[0],
+                                                     r.size(),
+                                                     detail::vectorized_params<T>);
+    }
+    for (size_t i = num_processed; i < r.size(); ++i) {
+        r[i] += other[i] * scalar;
+    }
+}
+
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
     // Tonelli-shanks algorithm begins by finding a field element Q and integer S,
@@ -0,0 +1,339 @@
+#include "field_vectorized.hpp"
+
+#if defined(__x86_64__) && !defined(__wasm__) && !defined(DISABLE_SHENANIGANS)
+#define BB_FIELD_VECTORIZED_IFMA 1
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC implements the immediate shift intrinsics with an _mm512_undefined_epi32() passthrough operand, which trips its
+// own uninitialized-use warnings once inlined
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#endif
+
+namespace bb::field_vectorized {
+
+#ifdef BB_FIELD_VECTORIZED_IFMA
+namespace {
+
+// The kernels are compiled for IFMA regardless of the target architecture and only called after a runtime check
+#define IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+#define IFMA_INLINE __attribute__((target("avx512f,avx512ifma"), always_inline)) inline
+
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+/**
+ * @brief Load 8 consecutive field elements and transpose them so that out[j] holds limb j of every element
+ */
+IFMA_INLINE void load_transposed(const uint64_t* src, __m512i* out)
+{
+    const __m512i z0 = _mm512_loadu_si512(src);
+    const __m512i z1 = _mm512_loadu_si512(src + 8);
+    const __m512i z2 = _mm512_loadu_si512(src + 16);
+    const __m512i z3 = _mm512_loadu_si512(src + 24);
+
+    const __m512i interleave_lo = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i interleave_hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i concat_lo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i concat_hi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+
+    // limbs 0, 1 (resp. 2, 3) of elements 0..3 and 4..7
+    const __m512i a01 = _mm512_permutex2var_epi64(z0, interleave_lo, z1);
+    const __m512i a23 = _mm512_permutex2var_epi64(z0, interleave_hi, z1);
+    const __m512i b01 = _mm512_permutex2var_epi64(z2, interleave_lo, z3);
+    const __m512i b23 = _mm512_permutex2var_epi64(z2, interleave_hi, z3);
+
+    out[0] = _mm512_permutex2var_epi64(a01, concat_lo, b01);
+    out[1] = _mm512_permutex2var_epi64(a01, concat_hi, b01);
+    out[2] = _mm512_permutex2var_epi64(a23, concat_lo, b23);
+    out[3] = _mm512_permutex2var_epi64(a23, concat_hi, b23);
+}
+
+/**
+ * @brief Inverse of load_transposed
+ */
+IFMA_INLINE void store_transposed(uint64_t* dst, const __m512i* in)
+{
+    const __m512i interleave_lo = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i interleave_hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i concat_lo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i concat_hi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+
+    const __m512i a01 = _mm512_permutex2var_epi64(in[0], concat_lo, in[1]);
+    const __m512i b01 = _mm512_permutex2var_epi64(in[0], concat_hi, in[1]);
+    const __m512i a23 = _mm512_permutex2var_epi64(in[2], concat_lo, in[3]);
+    const __m512i b23 = _mm512_permutex2var_epi64(in[2], concat_hi, in[3]);
+
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(a01, interleave_lo, a23));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(a01, interleave_hi, a23));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(b01, interleave_lo, b23));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(b01, interleave_hi, b23));
+}
+
+/**
+ * @brief Convert 4 x 64-bit limbs into 5 x 52-bit limbs
+ */
+IFMA_INLINE void to_radix_52(const __m512i* x, __m512i* r)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(LIMB_MASK));
+    r[0] = _mm512_and_si512(x[0], mask);
+    r[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[0], 52), _mm512_slli_epi64(x[1], 12)), mask);
+    r[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[1], 40), _mm512_slli_epi64(x[2], 24)), mask);
+    r[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[2], 28), _mm512_slli_epi64(x[3], 36)), mask);
+    r[4] = _mm512_srli_epi64(x[3], 16);
+}
+
+/**
+ * @brief Convert 4 x 64-bit limbs into 5 x 52-bit limbs, multiplying the value by 16
+ * @details A 5-limb Montgomery multiplication divides by 2^260 rather than 2^256. Scaling one of the operands by 16
+ * makes the product come out in the standard Montgomery form. For inputs < 2p < 2^255 this cannot overflow 260 bits.
+ */
+IFMA_INLINE void to_radix_52_times_16(const __m512i* x, __m512i* r)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(LIMB_MASK));
+    r[0] = _mm512_and_si512(_mm512_slli_epi64(x[0], 4), mask);
+    r[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[0], 48), _mm512_slli_epi64(x[1], 16)), mask);
+    r[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[1], 36), _mm512_slli_epi64(x[2], 28)), mask);
+    r[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[2], 24), _mm512_slli_epi64(x[3], 40)), mask);
+    r[4] = _mm512_srli_epi64(x[3], 12);
+}
+
+/**
+ * @brief Convert normalized 5 x 52-bit limbs (value < 2^256) back into 4 x 64-bit limbs
+ */
+IFMA_INLINE void from_radix_52(const __m512i* r, __m512i* x)
+{
+    x[0] = _mm512_or_si512(r[0], _mm512_slli_epi64(r[1], 52));
+    x[1] = _mm512_or_si512(_mm512_srli_epi64(r[1], 12), _mm512_slli_epi64(r[2], 40));
+    x[2] = _mm512_or_si512(_mm512_srli_epi64(r[2], 24), _mm512_slli_epi64(r[3], 28));
+    x[3] = _mm512_or_si512(_mm512_srli_epi64(r[3], 36), _mm512_slli_epi64(r[4], 16));
+}
+
+/**
+ * @brief Propagate carries so that every limb but the top one is < 2^52
+ */
+IFMA_INLINE void normalize(__m512i* t)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(LIMB_MASK));
+    for (size_t j = 0; j < 4; ++j) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+}
+
+/**
+ * @brief t = t - m if t >= m, for normalized t and m
+ */
+IFMA_INLINE void conditional_subtract(__m512i* t, const __m512i* m)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(LIMB_MASK));
+    __m512i borrow = _mm512_setzero_si512();
+    __m512i d[5];
+    for (size_t j = 0; j < 5; ++j) {
+        d[j] = _mm512_sub_epi64(_mm512_sub_epi64(t[j], m[j]), borrow);
+        borrow = _mm512_srli_epi64(d[j], 63);
+        d[j] = _mm512_and_si512(d[j], mask);
+    }
+    const __mmask8 no_borrow = _mm512_cmpeq_epi64_mask(borrow, _mm512_setzero_si512());
+    for (size_t j = 0; j < 5; ++j) {
+        t[j] = _mm512_mask_blend_epi64(no_borrow, t[j], d[j]);
+    }
+}
+
+struct Constants {
+    __m512i modulus[5];
+    __m512i twice_modulus[5];
+    __m512i r_inv;
+};
+
+IFMA_INLINE void load_constants(const MontgomeryParams& params, Constants& c)
+{
+    __m512i x[4];
+    __m512i x2[4];
+    uint64_t twice[4];
+    uint64_t carry = 0;
+    for (size_t j = 0; j < 4; ++j) {
+        twice[j] = (params.modulus[j] << 1) | carry;
+        carry = params.modulus[j] >> 63;
+    }
+    for (size_t j = 0; j < 4; ++j) {
+        x[j] = _mm512_set1_epi64(static_cast<long long>(params.modulus[j]));
+        x2[j] = _mm512_set1_epi64(static_cast<long long>(twice[j]));
+    }
+    to_radix_52(x, c.modulus);
+    to_radix_52(x2, c.twice_modulus);
+    c.r_inv = _mm512_set1_epi64(static_cast<long long>(params.r_inv & LIMB_MASK));
+}
+
+IFMA_INLINE void broadcast(const uint64_t* scalar, __m512i* x)
+{
+    for (size_t j = 0; j < 4; ++j) {
+        x[j] = _mm512_set1_epi64(static_cast<long long>(scalar[j]));
+    }
+}
+
+/**
+ * @brief Montgomery multiplication of 8 pairs of elements, r = a * b * 2^{-260} mod p, fully reduced into [0, p)
+ * @details Operand-scanning Montgomery multiplication over 52-bit limbs. The accumulator limbs are 64 bits wide and
+ * absorb the high and low halves of the partial products without intermediate carry propagation: each limb receives at
+ * most 20 additions of values < 2^52 over the course of the multiplication. For a < 32p, b < 2p and p < 2^254 the
+ * result is < 2p before the final conditional subtraction.
+ */
+IFMA_INLINE void montgomery_mul(const __m512i* a, const __m512i* b, const Constants& c, __m512i* r)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], a[i], b[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a[i], b[j]);
+        }
+        const __m512i m = _mm512_madd52lo_epu64(zero, t[0], c.r_inv);
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], m, c.modulus[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, c.modulus[j]);
+        }
+        // the low 52 bits of t[0] are now zero; shift the accumulator down by one limb
+        t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[5] = zero;
+    }
+    normalize(t);
+    conditional_subtract(t, c.modulus);
+    for (size_t j = 0; j < 5; ++j) {
+        r[j] = t[j];
+    }
+}
+
+IFMA_TARGET size_t mul_ifma(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, const MontgomeryParams& params)
+{
+    Constants c;
+    load_constants(params, c);
+    const size_t num_blocks = n / LANES;
+    for (size_t k = 0; k < num_blocks; ++k) {
+        const size_t offset = k * LANES * 4;
+        __m512i x[4];
+        __m512i a52[5];
+        __m512i b52[5];
+        __m512i r52[5];
+        load_transposed(a + offset, x);
+        to_radix_52_times_16(x, a52);
+        load_transposed(b + offset, x);
+        to_radix_52(x, b52);
+        montgomery_mul(a52, b52, c, r52);
+        from_radix_52(r52, x);
+        store_transposed(r + offset, x);
+    }
+    return num_blocks * LANES;
+}
+
+IFMA_TARGET size_t
+mul_by_scalar_ifma(uint64_t* r, const uint64_t* a, const uint64_t* scalar, size_t n, const MontgomeryParams& params)
+{
+    Constants c;
+    load_constants(params, c);
+    __m512i x[4];
+    __m512i s52[5];
+    broadcast(scalar, x);
+    to_radix_52_times_16(x, s52);
+    const size_t num_blocks = n / LANES;
+    for (size_t k = 0; k < num_blocks; ++k) {
+        const size_t offset = k * LANES * 4;
+        __m512i a52[5];
+        __m512i r52[5];
+        load_transposed(a + offset, x);
+        to_radix_52(x, a52);
+        montgomery_mul(s52, a52, c, r52);
+        from_radix_52(r52, x);
+        store_transposed(r + offset, x);
+    }
+    return num_blocks * LANES;
+}
+
+IFMA_TARGET size_t
+add_scaled_ifma(uint64_t* r, const uint64_t* a, const uint64_t* scalar, size_t n, const MontgomeryParams& params)
+{
+    Constants c;
+    load_constants(params, c);
+    __m512i x[4];
+    __m512i s52[5];
+    broadcast(scalar, x);
+    to_radix_52_times_16(x, s52);
+    const size_t num_blocks = n / LANES;
+    for (size_t k = 0; k < num_blocks; ++k) {
+        const size_t offset = k * LANES * 4;
+        __m512i a52[5];
+        __m512i r52[5];
+        __m512i acc52[5];
+        load_transposed(a + offset, x);
+        to_radix_52(x, a52);
+        montgomery_mul(s52, a52, c, r52);
+        load_transposed(r + offset, x);
+        to_radix_52(x, acc52);
+        // acc < 2p and a * scalar < p, so the sum is < 3p; reduce into the coarse range [0, 2p)
+        for (size_t j = 0; j < 5; ++j) {
+            acc52[j] = _mm512_add_epi64(acc52[j], r52[j]);
+        }
+        normalize(acc52);
+        conditional_subtract(acc52, c.twice_modulus);
+        from_radix_52(acc52, x);
+        store_transposed(r + offset, x);
+    }
+    return num_blocks * LANES;
+}
+
+#undef IFMA_INLINE
+#undef IFMA_TARGET
+
+} // namespace
+
+bool is_available() noexcept
+{
+    static const bool available = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return available;
+}
+
+size_t mul(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, const MontgomeryParams& params) noexcept
+{
+    return is_available() ? mul_ifma(r, a, b, n, params) : 0;
+}
+
+size_t mul_by_scalar(
+    uint64_t* r, const uint64_t* a, const uint64_t* scalar, size_t n, const MontgomeryParams& params) noexcept
+{
+    return is_available() ? mul_by_scalar_ifma(r, a, scalar, n, params) : 0;
+}
+
+size_t add_scaled(
+    uint64_t* r, const uint64_t* a, const uint64_t* scalar, size_t n, const MontgomeryParams& params) noexcept
+{
+    return is_available() ? add_scaled_ifma(r, a, scalar, n, params) : 0;
+}
+
+#else
+
+bool is_available() noexcept
+{
+    return false;
+}
+
+size_t mul(uint64_t*, const uint64_t*, const uint64_t*, size_t, const MontgomeryParams&) noexcept
+{
+    return 0;
+}
+
+size_t mul_by_scalar(uint64_t*, const uint64_t*, const uint64_t*, size_t, const MontgomeryParams&) noexcept
+{
+    return 0;
+}
+
+size_t add_scaled(uint64_t*, const uint64_t*, const uint64_t*, size_t, const MontgomeryParams&) noexcept
+{
+    return 0;
+}
+
+#endif
+
+} // namespace bb::field_vectorized
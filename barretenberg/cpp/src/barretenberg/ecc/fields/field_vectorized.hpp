@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Multi-lane Montgomery arithmetic for bulk field operations
+ * @details The scalar field code multiplies one element at a time using 64-bit limbs (MULX/ADX assembly or the generic
+ * __int128 fallback). On CPUs supporting AVX-512 IFMA we can instead hold 8 field elements in a 5 x 52-bit limb
+ * representation and multiply them in parallel with vpmadd52{lo,hi}uq.
+ *
+ * The kernels here are untyped: they operate on arrays of elements stored in the usual field layout (4 little-endian
+ * 64-bit limbs per element, Montgomery form with R = 2^256) and are parameterised by the modulus at runtime. They only
+ * support moduli < 2^254, for which the field code keeps elements in the coarse range [0, 2p).
+ *
+ * Each kernel processes the largest multiple of LANES elements it can and returns the number of elements processed.
+ * When the CPU does not support IFMA (or we are not compiling for x86_64) the kernels process nothing and return 0;
+ * callers are expected to handle the remaining elements with scalar arithmetic. Prefer the typed wrappers
+ * field::batch_mul / field::batch_add_scaled, which do exactly this.
+ */
+namespace bb::field_vectorized {
+
+static constexpr size_t LANES = 8;
+
+struct MontgomeryParams {
+    uint64_t modulus[4];
+    // -modulus^{-1} mod 2^64
+    uint64_t r_inv;
+};
+
+bool is_available() noexcept;
+
+// r[i] = a[i] * b[i]. r may alias a or b.
+size_t mul(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, const MontgomeryParams& params) noexcept;
+
+// r[i] = a[i] * scalar. r may alias a.
+size_t mul_by_scalar(
+    uint64_t* r, const uint64_t* a, const uint64_t* scalar, size_t n, const MontgomeryParams& params) noexcept;
+
+// r[i] += a[i] * scalar
+size_t add_scaled(
+    uint64_t* r, const uint64_t* a, const uint64_t* scalar, size_t n, const MontgomeryParams& params) noexcept;
+
+} // namespace bb::field_vectorized
@@ -1093,6 +1093,43 @@ void element<Fq, Fr, T>::conditional_negate_affine(const affine_element<Fq, Fr,
 template <typename Fq, typename Fr, typename T>
 void element<Fq, Fr, T>::batch_normalize(element* elements, const size_t num_elements) noexcept
 {
+    if constexpr (requires(std::span<Fq> coeffs) { Fq::parallel_batch_invert(coeffs); }) {
+        // Invert all z-coordinates at once (points at infinity contribute a zero, which the batch inversion skips),
+        // then convert out of Jacobian form (x = X / Z^2, y = Y / Z^3) with 4 muls and 1 square per point
+        std::vector<Fq> z_inverses(num_elements);
+        run_loop_in_parallel_if_effective(
+            num_elements,
+            [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    z_inverses[i] = elements[i].is_point_at_infinity() ? Fq::zero() : elements[i].z;
+                }
+            },
+            /*finite_field_additions_per_iteration=*/0,
+            /*finite_field_multiplications_per_iteration=*/0,
+            /*finite_field_inversions_per_iteration=*/0,
+            /*group_element_additions_per_iteration=*/0,
+            /*group_element_doublings_per_iteration=*/0,
+            /*scalar_multiplications_per_iteration=*/0,
+            /*sequential_copy_ops_per_iteration=*/1);
+        Fq::parallel_batch_invert(z_inverses);
+        run_loop_in_parallel_if_effective(
+            num_elements,
+            [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    if (!elements[i].is_point_at_infinity()) {
+                        const Fq zz_inv = z_inverses[i].sqr();
+                        elements[i].x *= zz_inv;
+                        elements[i].y *= (zz_inv * z_inverses[i]);
+                    }
+                    elements[i].z = Fq::one();
+                }
+            },
+            /*finite_field_additions_per_iteration=*/0,
+            /*finite_field_multiplications_per_iteration=*/5);
+        return;
+    }
+
+    // Extension fields (e.g. G2) use the serial Montgomery trick below
     std::vector<Fq> temporaries;
     temporaries.reserve(num_elements * 2);
     Fq accumulator = Fq::one();
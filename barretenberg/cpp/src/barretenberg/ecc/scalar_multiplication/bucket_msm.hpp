@@ -0,0 +1,79 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Compute sum_i scalars[i] * points[i] with the bucket method, for any group
+ *
+ * @details `pippenger` relies on the curve endomorphism and on a precomputed point table, and is only instantiated for
+ * BN254 and Grumpkin. This is the plain bucket method: scalars are cut into windows of c bits, and each window is
+ * processed on its own thread, adding every point into the bucket of its digit and summing the buckets with a running
+ * sum. The window sums are then combined with c doublings each. Additions are projective (mixed), so there is no batch
+ * inversion to schedule, which suits the MSMs of a few thousand points of batch signature verification.
+ *
+ * @tparam Group a group over a prime field, e.g. secp256k1::g1
+ */
+template <typename Group>
+typename Group::element bucket_msm(std::span<const typename Group::affine_element> points,
+                                   std::span<const typename Group::subgroup_field> scalars)
+{
+    using element = typename Group::element;
+    using Fr = typename Group::subgroup_field;
+    ASSERT(points.size() == scalars.size());
+    const size_t num_points = points.size();
+
+    // A window of c bits costs num_points additions plus 2^(c+1) to sum its buckets
+    const size_t log_num_points = num_points == 0 ? 0 : static_cast<size_t>(numeric::get_msb(num_points));
+    const size_t c = std::clamp<size_t>(log_num_points, 4, 18) - 2;
+    const size_t num_bits = static_cast<size_t>(Fr::modulus.get_msb()) + 1;
+    const size_t num_windows = (num_bits + c - 1) / c;
+
+    std::vector<uint256_t> converted_scalars(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        converted_scalars[i] = uint256_t(scalars[i]);
+    }
+
+    std::vector<element> window_sums(num_windows);
+    parallel_for(num_windows, [&](size_t window) {
+        std::vector<element> buckets(1UL << c);
+        for (auto& bucket : buckets) {
+            bucket.self_set_infinity();
+        }
+        const uint64_t start = window * c;
+        for (size_t i = 0; i < num_points; ++i) {
+            const auto digit = static_cast<size_t>(converted_scalars[i].slice(start, start + c).data[0]);
+            if (digit != 0 && !points[i].is_point_at_infinity()) {
+                buckets[digit - 1] += points[i];
+            }
+        }
+        // sum_d d * buckets[d - 1], as the sum of the running sums from the top bucket down
+        element running_sum;
+        element window_sum;
+        running_sum.self_set_infinity();
+        window_sum.self_set_infinity();
+        for (size_t d = buckets.size(); d > 0; --d) {
+            running_sum += buckets[d - 1];
+            window_sum += running_sum;
+        }
+        window_sums[window] = window_sum;
+    });
+
+    element result = window_sums.back();
+    for (size_t window = num_windows - 1; window > 0; --window) {
+        for (size_t i = 0; i < c; ++i) {
+            result.self_dbl();
+        }
+        result += window_sums[window - 1];
+    }
+    return result;
+}
+
+} // namespace bb::scalar_multiplication
@@ -131,6 +131,25 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
             poly = Polynomial(circuit_size);
         }
     };
+    /**
+     * @brief Construct a proving key whose precomputed polynomials share memory with the given ones (e.g. those held
+     * by a PrecomputedCache_). Only the witness polynomials are allocated.
+     *
+     * @param precomputed Polynomials ordered as in get_precomputed_polynomials()
+     */
+    ProvingKey_(const size_t circuit_size, const size_t num_public_inputs, std::span<const Polynomial> precomputed)
+    {
+        this->evaluation_domain = bb::EvaluationDomain<FF>(circuit_size, circuit_size);
+        PrecomputedPolynomials::circuit_size = circuit_size;
+        this->log_circuit_size = numeric::get_msb(circuit_size);
+        this->num_public_inputs = num_public_inputs;
+        for (auto [poly, precomputed_poly] : zip_view(PrecomputedPolynomials::get_all(), precomputed)) {
+            poly = precomputed_poly.share();
+        }
+        for (auto& poly : WitnessPolynomials::get_all()) {
+            poly = Polynomial(circuit_size);
+        }
+    };
 };
 
 /**
@@ -6,6 +6,7 @@
 // while DEFINE_COMPOUND_GET_ALL lets you combine the iterators of substructures or base
 // classes.
 
+#include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/common/ref_vector.hpp"
 #include "barretenberg/common/std_array.hpp"
 #include "barretenberg/common/std_string.hpp"
@@ -40,15 +41,17 @@ template <typename T, typename... BaseClass> auto _concatenate_base_class_get_la
 #define DEFINE_REF_VIEW(...)                                                                                           \
     [[nodiscard]] auto get_all()                                                                                       \
     {                                                                                                                  \
-        return RefVector{ __VA_ARGS__ };                                                                               \
+        return RefArray{ __VA_ARGS__ };                                                                                \
     }                                                                                                                  \
     [[nodiscard]] auto get_all() const                                                                                 \
     {                                                                                                                  \
-        return RefVector{ __VA_ARGS__ };                                                                               \
+        return RefArray{ __VA_ARGS__ };                                                                                \
     }
 
 /**
  * @brief Define the body of a flavor class, included each member and a pointer view with which to iterate the struct.
+ * @details The view is a RefArray, whose size is known at compile time, so getting it does not allocate; rows of
+ * polynomials can be read in hot loops through it.
  *
  * @tparam T The underlying data type stored in the array
  * @tparam HandleType The type that will be used to
@@ -344,7 +344,7 @@ class GoblinTranslator {
 
         // everything but ConcatenatedRangeConstraints
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/810)
-        RefVector<DataType> get_unshifted_wires()
+        auto get_unshifted_wires()
         {
             return concatenate(WireNonshiftedEntities<DataType>::get_all(),
                                WireToBeShiftedEntities<DataType>::get_all(),
@@ -358,7 +358,7 @@ class GoblinTranslator {
                                WireToBeShiftedEntities<DataType>::get_labels(),
                                DerivedWitnessEntities<DataType>::get_labels());
         }
-        RefVector<DataType> get_to_be_shifted()
+        auto get_to_be_shifted()
         {
             return concatenate(WireToBeShiftedEntities<DataType>::get_all(),
                                DerivedWitnessEntities<DataType>::get_all());
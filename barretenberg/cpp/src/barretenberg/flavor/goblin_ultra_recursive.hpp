@@ -52,6 +52,7 @@ template <typename BuilderType> class GoblinUltraRecursive_ {
     using VerifierCommitmentKey = pcs::VerifierCommitmentKey<Curve>;
 
     static constexpr size_t NUM_WIRES = flavor::GoblinUltra::NUM_WIRES;
+    static constexpr TranscriptHashType TRANSCRIPT_HASH_TYPE = flavor::GoblinUltra::TRANSCRIPT_HASH_TYPE;
     // The number of multivariate polynomials on which a sumcheck prover sumcheck operates (including shifts). We often
     // need containers of this size to hold related data, so we choose a name more agnostic than `NUM_POLYNOMIALS`.
     // Note: this number does not include the individual sorted list polynomials.
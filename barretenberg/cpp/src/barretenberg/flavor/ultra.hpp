@@ -78,6 +78,9 @@ class Ultra {
     // Whether or not the first row of the execution trace is reserved for 0s to enable shifts
     static constexpr bool has_zero_row = true;
 
+    // The hash from which the transcript derives its challenges; the recursive verifier must use the same one
+    static constexpr TranscriptHashType TRANSCRIPT_HASH_TYPE = TranscriptHashType::Poseidon2;
+
     static constexpr bool is_decider = true;
 
   private:
@@ -117,14 +120,14 @@ class Ultra {
 
         static constexpr CircuitType CIRCUIT_TYPE = CircuitBuilder::CIRCUIT_TYPE;
 
-        RefVector<DataType> get_selectors()
+        auto get_selectors()
         {
-            return { q_m, q_c, q_l, q_r, q_o, q_4, q_arith, q_sort, q_elliptic, q_aux, q_lookup };
+            return RefArray{ q_m, q_c, q_l, q_r, q_o, q_4, q_arith, q_sort, q_elliptic, q_aux, q_lookup };
         };
-        RefVector<DataType> get_sigma_polynomials() { return { sigma_1, sigma_2, sigma_3, sigma_4 }; };
-        RefVector<DataType> get_id_polynomials() { return { id_1, id_2, id_3, id_4 }; };
+        auto get_sigma_polynomials() { return RefArray{ sigma_1, sigma_2, sigma_3, sigma_4 }; };
+        auto get_id_polynomials() { return RefArray{ id_1, id_2, id_3, id_4 }; };
 
-        RefVector<DataType> get_table_polynomials() { return { table_1, table_2, table_3, table_4 }; };
+        auto get_table_polynomials() { return RefArray{ table_1, table_2, table_3, table_4 }; };
     };
 
     /**
@@ -142,7 +145,7 @@ class Ultra {
                               z_perm,       // column 5
                               z_lookup)     // column 6
 
-        RefVector<DataType> get_wires() { return { w_l, w_r, w_o, w_4, sorted_accum, z_perm, z_lookup }; };
+        auto get_wires() { return RefArray{ w_l, w_r, w_o, w_4, sorted_accum, z_perm, z_lookup }; };
     };
 
     /**
@@ -163,10 +166,10 @@ class Ultra {
                               z_perm_shift,       // column 9
                               z_lookup_shift)     // column 10
 
-        RefVector<DataType> get_shifted()
+        auto get_shifted()
         {
-            return { table_1_shift, table_2_shift, table_3_shift,      table_4_shift, w_l_shift,     w_r_shift,
-                     w_o_shift,     w_4_shift,     sorted_accum_shift, z_perm_shift,  z_lookup_shift };
+            return RefArray{ table_1_shift, table_2_shift, table_3_shift, table_4_shift, w_l_shift, w_r_shift,
+                             w_o_shift, w_4_shift, sorted_accum_shift, z_perm_shift, z_lookup_shift };
         };
     };
 
@@ -226,37 +229,31 @@ class Ultra {
                               z_perm_shift,       // column 41
                               z_lookup_shift)     // column 42
 
-        RefVector<DataType> get_wires() { return { w_l, w_r, w_o, w_4 }; };
+        auto get_wires() { return RefArray{ w_l, w_r, w_o, w_4 }; };
         // Gemini-specific getters.
-        RefVector<DataType> get_unshifted()
+        auto get_unshifted()
         {
-            return { q_m,           q_c,   q_l,      q_r,     q_o,     q_4,          q_arith, q_sort,
-                     q_elliptic,    q_aux, q_lookup, sigma_1, sigma_2, sigma_3,      sigma_4, id_1,
-                     id_2,          id_3,  id_4,     table_1, table_2, table_3,      table_4, lagrange_first,
-                     lagrange_last, w_l,   w_r,      w_o,     w_4,     sorted_accum, z_perm,  z_lookup
-
-            };
+            return RefArray{ q_m, q_c, q_l, q_r, q_o, q_4, q_arith, q_sort, q_elliptic, q_aux, q_lookup, sigma_1,
+                             sigma_2, sigma_3, sigma_4, id_1, id_2, id_3, id_4, table_1, table_2, table_3, table_4,
+                             lagrange_first, lagrange_last, w_l, w_r, w_o, w_4, sorted_accum, z_perm, z_lookup };
         };
 
-        RefVector<DataType> get_precomputed()
+        auto get_precomputed()
         {
-            return { q_m,          q_c,   q_l,      q_r,     q_o,     q_4,     q_arith, q_sort,
-                     q_elliptic,   q_aux, q_lookup, sigma_1, sigma_2, sigma_3, sigma_4, id_1,
-                     id_2,         id_3,  id_4,     table_1, table_2, table_3, table_4, lagrange_first,
-                     lagrange_last
-
-            };
+            return RefArray{ q_m, q_c, q_l, q_r, q_o, q_4, q_arith, q_sort, q_elliptic, q_aux, q_lookup, sigma_1,
+                             sigma_2, sigma_3, sigma_4, id_1, id_2, id_3, id_4, table_1, table_2, table_3, table_4,
+                             lagrange_first, lagrange_last };
         }
 
-        RefVector<DataType> get_witness() { return { w_l, w_r, w_o, w_4, sorted_accum, z_perm, z_lookup }; };
-        RefVector<DataType> get_to_be_shifted()
+        auto get_witness() { return RefArray{ w_l, w_r, w_o, w_4, sorted_accum, z_perm, z_lookup }; };
+        auto get_to_be_shifted()
         {
-            return { table_1, table_2, table_3, table_4, w_l, w_r, w_o, w_4, sorted_accum, z_perm, z_lookup };
+            return RefArray{ table_1, table_2, table_3, table_4, w_l, w_r, w_o, w_4, sorted_accum, z_perm, z_lookup };
         };
-        RefVector<DataType> get_shifted()
+        auto get_shifted()
         {
-            return { table_1_shift, table_2_shift, table_3_shift,      table_4_shift, w_l_shift,     w_r_shift,
-                     w_o_shift,     w_4_shift,     sorted_accum_shift, z_perm_shift,  z_lookup_shift };
+            return RefArray{ table_1_shift, table_2_shift, table_3_shift, table_4_shift, w_l_shift, w_r_shift,
+                             w_o_shift, w_4_shift, sorted_accum_shift, z_perm_shift, z_lookup_shift };
         };
     };
 
@@ -275,10 +272,10 @@ class Ultra {
         std::vector<uint32_t> memory_read_records;
         std::vector<uint32_t> memory_write_records;
 
-        RefVector<DataType> get_to_be_shifted()
+        auto get_to_be_shifted()
         {
-            return { this->table_1, this->table_2, this->table_3,      this->table_4, this->w_l,     this->w_r,
-                     this->w_o,     this->w_4,     this->sorted_accum, this->z_perm,  this->z_lookup };
+            return RefArray{ this->table_1, this->table_2, this->table_3, this->table_4, this->w_l, this->w_r,
+                             this->w_o, this->w_4, this->sorted_accum, this->z_perm, this->z_lookup };
         };
         // The plookup wires that store plookup read data.
         std::array<PolynomialHandle, 3> get_table_column_wires() { return { w_l, w_r, w_o }; };
@@ -478,11 +475,13 @@ class Ultra {
         Commitment zm_cq_comm;
         Commitment zm_pi_comm;
 
-        Transcript() = default;
+        Transcript()
+            : BaseTranscript(TRANSCRIPT_HASH_TYPE)
+        {}
 
         // Used by verifier to initialize the transcript
         Transcript(const std::vector<uint8_t>& proof)
-            : BaseTranscript(proof)
+            : BaseTranscript(proof, TRANSCRIPT_HASH_TYPE)
         {}
 
         static std::shared_ptr<Transcript> prover_init_empty()
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#ifndef NO_MULTITHREADING
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace bb {
+
+/**
+ * @brief A bounded FIFO of proving jobs, drained by a single background thread
+ * @details Used by Goblin::accumulate_async so that the caller can generate the witness of the next circuit while the
+ * previous ones are being proven. Jobs run one at a time and in the order they were submitted (each one is free to use
+ * the whole thread pool internally). Submission blocks while max_pending jobs are already waiting, which bounds the
+ * number of built but not yet proven circuits held in memory. Without multithreading, jobs run on the submitting
+ * thread.
+ */
+class AccumulationPipeline {
+  public:
+    using Job = std::function<void()>;
+
+    explicit AccumulationPipeline(size_t max_pending = 2)
+        : max_pending(max_pending == 0 ? 1 : max_pending)
+    {
+#ifndef NO_MULTITHREADING
+        worker = std::thread([this]() { run(); });
+#endif
+    }
+
+    AccumulationPipeline(const AccumulationPipeline&) = delete;
+    AccumulationPipeline(AccumulationPipeline&&) = delete;
+    AccumulationPipeline& operator=(const AccumulationPipeline&) = delete;
+    AccumulationPipeline& operator=(AccumulationPipeline&&) = delete;
+
+    ~AccumulationPipeline()
+    {
+#ifndef NO_MULTITHREADING
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        job_available.notify_all();
+        worker.join();
+#endif
+    }
+
+    /**
+     * @brief Queue a job, blocking while the queue is full
+     */
+    void submit(Job job)
+    {
+#ifdef NO_MULTITHREADING
+        job();
+#else
+        std::unique_lock<std::mutex> lock(mutex);
+        slot_available.wait(lock, [this]() { return pending.size() < max_pending; });
+        pending.emplace_back(std::move(job));
+        lock.unlock();
+        job_available.notify_one();
+#endif
+    }
+
+    /**
+     * @brief Block until every submitted job has completed
+     */
+    void wait_until_idle()
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this]() { return pending.empty() && !busy; });
+#endif
+    }
+
+  private:
+    size_t max_pending;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+    std::condition_variable job_available;
+    std::condition_variable slot_available;
+    std::condition_variable idle;
+    std::deque<Job> pending;
+    bool busy = false;
+    bool stopping = false;
+    std::thread worker;
+
+    void run()
+    {
+        while (true) {
+            std::unique_lock<std::mutex> lock(mutex);
+            job_available.wait(lock, [this]() { return stopping || !pending.empty(); });
+            // Drain the queue before stopping so that no submitted job is dropped
+            if (pending.empty()) {
+                return;
+            }
+            Job job = std::move(pending.front());
+            pending.pop_front();
+            busy = true;
+            lock.unlock();
+            slot_available.notify_one();
+
+            job();
+
+            lock.lock();
+            busy = false;
+            bool now_idle = pending.empty();
+            lock.unlock();
+            if (now_idle) {
+                idle.notify_all();
+            }
+        }
+    }
+#endif
+};
+
+} // namespace bb
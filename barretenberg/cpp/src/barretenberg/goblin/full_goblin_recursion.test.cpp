@@ -59,4 +59,49 @@ TEST_F(GoblinRecursionTests, Pseudo)
     EXPECT_TRUE(ultra_verified && verified);
 }
 
+/**
+ * @brief The same flow using the accumulation pipeline; app circuits are built while the previous kernel is proven
+ *
+ */
+TEST_F(GoblinRecursionTests, PseudoPipelined)
+{
+    Goblin goblin;
+
+    // Construct an initial circuit; its proof will be recursively verified by the first kernel
+    GoblinUltraBuilder initial_circuit{ goblin.op_queue };
+    GoblinMockCircuits::construct_simple_initial_circuit(initial_circuit);
+    auto kernel_output = goblin.accumulate_async(std::move(initial_circuit));
+
+    std::vector<std::future<KernelInput>> app_outputs;
+    size_t NUM_CIRCUITS = 2;
+    for (size_t circuit_idx = 0; circuit_idx < NUM_CIRCUITS; ++circuit_idx) {
+        // An app circuit does not depend on the previous kernel proof, so it is built while that proof is constructed
+        GoblinUltraBuilder app_circuit{ goblin.op_queue };
+        GoblinMockCircuits::construct_arithmetic_circuit(app_circuit, /*num_gates=*/1 << 4);
+        GoblinMockCircuits::construct_goblin_ecc_op_circuit(app_circuit);
+        app_outputs.emplace_back(goblin.accumulate_async(std::move(app_circuit)));
+
+        // Construct a circuit with logic resembling that of the "kernel circuit"
+        KernelInput kernel_input = kernel_output.get();
+        GoblinUltraBuilder circuit_builder{ goblin.op_queue };
+        GoblinMockCircuits::construct_mock_kernel_circuit(circuit_builder, kernel_input);
+        kernel_output = goblin.accumulate_async(std::move(circuit_builder));
+    }
+    KernelInput kernel_input = kernel_output.get();
+
+    Goblin::Proof proof = goblin.prove();
+    // Verify the app proofs and the final kernel proof
+    bool ultra_verified = true;
+    for (auto& app_output : app_outputs) {
+        KernelInput app_input = app_output.get();
+        GoblinUltraVerifier app_verifier{ app_input.verification_key };
+        ultra_verified = ultra_verified && app_verifier.verify_proof(app_input.proof);
+    }
+    GoblinUltraVerifier ultra_verifier{ kernel_input.verification_key };
+    ultra_verified = ultra_verified && ultra_verifier.verify_proof(kernel_input.proof);
+    // Verify the goblin proof (eccvm, translator, merge)
+    bool verified = goblin.verify(proof);
+    EXPECT_TRUE(ultra_verified && verified);
+}
+
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/787) Expand these tests.
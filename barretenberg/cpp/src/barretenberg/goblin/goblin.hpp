@@ -1,6 +1,7 @@
 #pragma once
 
 #include "barretenberg/eccvm/eccvm_composer.hpp"
+#include "barretenberg/goblin/accumulation_pipeline.hpp"
 #include "barretenberg/proof_system/circuit_builder/eccvm/eccvm_circuit_builder.hpp"
 #include "barretenberg/proof_system/circuit_builder/goblin_translator_circuit_builder.hpp"
 #include "barretenberg/proof_system/circuit_builder/goblin_ultra_circuit_builder.hpp"
@@ -9,6 +10,8 @@
 #include "barretenberg/translator_vm/goblin_translator_composer.hpp"
 #include "barretenberg/ultra_honk/ultra_composer.hpp"
 
+#include <future>
+
 namespace bb {
 
 class Goblin {
@@ -67,6 +70,10 @@ class Goblin {
     using TranslatorComposer = bb::honk::GoblinTranslatorComposer;
     using RecursiveMergeVerifier = bb::stdlib::recursion::goblin::MergeRecursiveVerifier_<GoblinUltraCircuitBuilder>;
     using MergeVerifier = bb::honk::MergeVerifier_<GUHFlavor>;
+    using MergeProver = bb::honk::MergeProver_<GUHFlavor>;
+
+    // Number of built circuits that accumulate_async may queue ahead of the background prover
+    static constexpr size_t MAX_PENDING_ACCUMULATIONS = 2;
 
     std::shared_ptr<OpQueue> op_queue = std::make_shared<OpQueue>();
 
@@ -86,6 +93,32 @@ class Goblin {
 
     AccumulationOutput accumulator; // Used only for ACIR methods for now
 
+    // Merge proof of the last circuit handed to accumulate_async, until it is moved into merge_proof
+    std::shared_future<HonkProof> pending_merge_proof;
+
+    // Declared last so that it is destroyed (and its queued jobs finished) before anything else
+    std::unique_ptr<AccumulationPipeline> pipeline;
+
+    /**
+     * @brief Wait for the background prover to finish every queued circuit and take ownership of the last merge proof
+     *
+     */
+    void wait_for_pending_accumulations()
+    {
+        if (pipeline) {
+            pipeline->wait_until_idle();
+        }
+        take_pending_merge_proof();
+    }
+
+    void take_pending_merge_proof()
+    {
+        if (pending_merge_proof.valid()) {
+            merge_proof = pending_merge_proof.get();
+            pending_merge_proof = {};
+        }
+    }
+
   public:
     /**
      * @brief Construct a GUH proof and a merge proof for the present circuit.
@@ -95,6 +128,8 @@ class Goblin {
      */
     AccumulationOutput accumulate(GoblinUltraCircuitBuilder& circuit_builder)
     {
+        wait_for_pending_accumulations();
+
         // Complete the circuit logic by recursively verifying previous merge proof if it exists
         if (merge_proof_exists) {
             RecursiveMergeVerifier merge_verifier{ &circuit_builder };
@@ -105,10 +140,12 @@ class Goblin {
         GoblinUltraComposer composer;
         auto instance = composer.create_instance(circuit_builder);
         auto prover = composer.create_prover(instance);
+        prover.transcript->disable_manifest();
         auto ultra_proof = prover.construct_proof();
 
         // Construct and store the merge proof to be recursively verified on the next call to accumulate
         auto merge_prover = composer.create_merge_prover(op_queue);
+        merge_prover.transcript->disable_manifest();
         merge_proof = merge_prover.construct_proof();
 
         if (!merge_proof_exists) {
@@ -118,6 +155,67 @@ class Goblin {
         return { ultra_proof, instance->verification_key };
     };
 
+    /**
+     * @brief Hand the present circuit to a background prover and return a future for its GUH proof
+     * @details Pipelined counterpart of accumulate. The circuit is completed here, on the calling thread, by
+     * recursively verifying the previous merge proof; this is the only point at which the caller waits on the
+     * background prover. The GUH and merge proofs are then constructed on a background thread, so that the caller can
+     * generate the witness of the next circuit in the meantime. Circuits are proven in the order they are submitted and
+     * at most MAX_PENDING_ACCUMULATIONS of them wait in the queue at once.
+     *
+     * The merge prover works on a copy of T_i, since building the next circuit appends to the op queue. While
+     * accumulations are in flight, the op queue commitments are owned by the background prover.
+     *
+     * @param circuit_builder A circuit built on op_queue; it is moved into the background job
+     * @return std::future<AccumulationOutput>
+     */
+    std::future<AccumulationOutput> accumulate_async(GoblinUltraCircuitBuilder&& circuit_builder)
+    {
+        // Complete the circuit logic by recursively verifying previous merge proof if it exists
+        take_pending_merge_proof();
+        if (merge_proof_exists) {
+            RecursiveMergeVerifier merge_verifier{ &circuit_builder };
+            [[maybe_unused]] auto pairing_points = merge_verifier.verify_proof(merge_proof);
+        }
+
+        // The circuit is now complete, so M_i is final; everything the background prover needs is captured by value
+        op_queue->set_size_data();
+        auto merge_op_queue = op_queue->get_ultra_ops_snapshot();
+        auto circuit = std::make_shared<GoblinUltraCircuitBuilder>(std::move(circuit_builder));
+        auto merge_promise = std::make_shared<std::promise<HonkProof>>();
+        auto output_promise = std::make_shared<std::promise<AccumulationOutput>>();
+
+        pending_merge_proof = merge_promise->get_future().share();
+        merge_proof_exists = true;
+        auto output = output_promise->get_future();
+
+        if (!pipeline) {
+            pipeline = std::make_unique<AccumulationPipeline>(MAX_PENDING_ACCUMULATIONS);
+        }
+        pipeline->submit([shared_op_queue = op_queue, merge_op_queue, circuit, merge_promise, output_promise]() {
+            GoblinUltraComposer composer;
+
+            // The merge proof goes first since the next circuit cannot be completed without it. The commitments
+            // [T_{i-1}] are those left in the shared op queue by the previous job.
+            merge_op_queue->ultra_ops_commitments = shared_op_queue->ultra_ops_commitments;
+            merge_op_queue->previous_ultra_ops_commitments = shared_op_queue->previous_ultra_ops_commitments;
+            MergeProver merge_prover{ composer.compute_commitment_key(merge_op_queue->get_current_size()),
+                                      merge_op_queue,
+                                      std::make_shared<GUHFlavor::Transcript>() };
+            merge_prover.transcript->disable_manifest();
+            merge_promise->set_value(merge_prover.construct_proof());
+            shared_op_queue->set_commitment_data(merge_op_queue->ultra_ops_commitments);
+
+            auto instance = composer.create_instance(*circuit);
+            auto prover = composer.create_prover(instance);
+            prover.transcript->disable_manifest();
+            auto ultra_proof = prover.construct_proof();
+            output_promise->set_value({ ultra_proof, instance->verification_key });
+        });
+
+        return output;
+    };
+
     /**
      * @brief Construct an ECCVM proof and the translation polynomial evaluations
      *
@@ -127,6 +225,8 @@ class Goblin {
         eccvm_builder = std::make_unique<ECCVMBuilder>(op_queue);
         eccvm_composer = std::make_unique<ECCVMComposer>();
         eccvm_prover = std::make_unique<ECCVMProver>(eccvm_composer->create_prover(*eccvm_builder));
+        // The translator prover carries on with this transcript, so neither records a manifest
+        eccvm_prover->transcript->disable_manifest();
         goblin_proof.eccvm_proof = eccvm_prover->construct_proof();
         goblin_proof.translation_evaluations = eccvm_prover->translation_evaluations;
     };
@@ -147,12 +247,13 @@ class Goblin {
     /**
      * @brief Constuct a full Goblin proof (ECCVM, Translator, merge)
      * @details The merge proof is assumed to already have been constucted in the last accumulate step. It is simply
-     * moved into the final proof here.
+     * moved into the final proof here, once any pipelined accumulations have completed.
      *
      * @return Proof
      */
     Proof prove()
     {
+        wait_for_pending_accumulations();
         goblin_proof.merge_proof = std::move(merge_proof);
         prove_eccvm();
         prove_translator();
@@ -205,6 +306,7 @@ class Goblin {
         GoblinUltraComposer composer;
         auto instance = composer.create_instance(circuit_builder);
         auto prover = composer.create_prover(instance);
+        prover.transcript->disable_manifest();
         auto ultra_proof = prover.construct_proof();
 
         accumulator = { ultra_proof, instance->verification_key };
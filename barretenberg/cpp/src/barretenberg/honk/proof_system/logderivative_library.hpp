@@ -1,8 +1,36 @@
 #pragma once
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/zip_view.hpp"
 #include <typeinfo>
 
 namespace bb::honk::logderivative_library {
 
+/**
+ * @brief A lazily read entry of a prover polynomial, at the row a thread is currently processing
+ * @details An entity container of ColumnReaders, bound once per chunk of rows, stands in for the row returned by
+ * get_row(i): only the columns a relation actually evaluates are read, and advancing to the next row is a single
+ * increment of the shared row index, rather than a copy of every column of the trace.
+ */
+template <typename FF, typename Polynomial> struct ColumnReader {
+    const Polynomial* polynomial = nullptr;
+    const size_t* row_idx = nullptr;
+
+    operator FF() const { return (*polynomial)[*row_idx]; } // NOLINT(google-explicit-constructor)
+
+    friend bool operator==(const ColumnReader& reader, const FF& value) { return FF(reader) == value; }
+    friend bool operator>(const ColumnReader& reader, const FF& value) { return FF(reader) > value; }
+};
+
+/**
+ * @brief Recover the entity class template behind AllEntities<FF>, e.g. from Flavor::AllValues::Base, and apply it to
+ * another data type
+ */
+template <typename Entities, typename DataType> struct RebindEntities;
+template <template <typename> class Entities, typename FF, typename DataType>
+struct RebindEntities<Entities<FF>, DataType> {
+    using type = Entities<DataType>;
+};
+
 /**
  * @brief Compute the inverse polynomial I(X) required for logderivative lookups
  * *
@@ -21,40 +49,55 @@ namespace bb::honk::logderivative_library {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * The rows are split into chunks processed in parallel. Each thread reads the trace through ColumnReaders, so that
+ * inactive rows only cost a read of the relation's predicate columns, and batch-inverts its own chunk.
+ *
  */
 template <typename Flavor, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
 {
     using FF = typename Flavor::FF;
     using Accumulator = typename Relation::ValueAccumulator0;
+    using Reader = ColumnReader<FF, typename Flavor::Polynomial>;
+    using RowReaders = typename RebindEntities<typename Flavor::AllValues::Base, Reader>::type;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
+    constexpr size_t MIN_ROWS_PER_THREAD = 64;
 
     auto lookup_relation = Relation();
 
     auto& inverse_polynomial = lookup_relation.template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        auto row = polynomials.get_row(i);
-        bool has_inverse = lookup_relation.operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
-        }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial[i] = denominator;
-    };
-
-    // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+    run_loop_in_parallel(
+        circuit_size,
+        [&](size_t start, size_t end) {
+            size_t row_idx = start;
+            RowReaders row;
+            for (auto [reader, polynomial] : zip_view(row.get_all(), polynomials.get_all())) {
+                reader.polynomial = &polynomial;
+                reader.row_idx = &row_idx;
+            }
+            for (; row_idx < end; ++row_idx) {
+                bool has_inverse = lookup_relation.operation_exists_at_row(row);
+                if (!has_inverse) {
+                    continue;
+                }
+                FF denominator = 1;
+                bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                    auto denominator_term =
+                        lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                    auto denominator_term =
+                        lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                inverse_polynomial[row_idx] = denominator;
+            }
+            // Rows without a lookup operation are zero and are skipped by the inversion
+            FF::batch_invert(&inverse_polynomial[start], end - start);
+        },
+        MIN_ROWS_PER_THREAD);
 }
 
 /**
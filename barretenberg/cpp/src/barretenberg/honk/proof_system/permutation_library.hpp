@@ -122,11 +122,11 @@ void compute_permutation_grand_product(const size_t circuit_size,
                 denominator[i] *= denominator_scaling;
             }
         }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator[start], block_size });
     });
 
+    // Final step: invert denominator
+    FF::parallel_batch_invert(denominator);
+
     // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
     auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
     grand_product_polynomial[0] = 0;
@@ -18,6 +18,7 @@ namespace bb::plonk {
 void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_proving_key,
                                                std::vector<SelectorProperties> selector_properties)
 {
+    std::vector<bb::polynomial> selector_polys_fft;
     for (size_t i = 0; i < selector_properties.size(); i++) {
         // Compute monomial form of selector polynomial
         auto selector_poly_lagrange =
@@ -26,14 +27,23 @@ void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_provi
         bb::polynomial_arithmetic::ifft(
             &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
 
-        // Compute coset FFT of selector polynomial
-        bb::polynomial selector_poly_fft(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+        selector_polys_fft.emplace_back(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
 
         // Note: For Standard, the lagrange polynomials could be removed from the store at this point but this
         // is not the case for Ultra.
         circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft", std::move(selector_poly_fft));
+    }
+
+    // Compute the coset FFTs of all selector polynomials in one batch
+    std::vector<bb::fr*> selector_fft_ptrs;
+    for (auto& selector_poly_fft : selector_polys_fft) {
+        selector_fft_ptrs.push_back(selector_poly_fft.data().get());
+    }
+    bb::polynomial_arithmetic::coset_fft_batch(selector_fft_ptrs, circuit_proving_key->large_domain);
+
+    for (size_t i = 0; i < selector_properties.size(); i++) {
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft",
+                                                  std::move(selector_polys_fft[i]));
     }
 }
 
@@ -247,18 +247,8 @@ void work_queue::process_queue()
         //     }
         //     break;
         // }
+        // FFT items are processed together after the loop
         case WorkType::FFT: {
-            using namespace bb;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
-
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-
             break;
         }
         // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
@@ -278,9 +268,43 @@ void work_queue::process_queue()
         }
         }
     }
+    process_fft_items();
     work_item_queue = std::vector<work_item>();
 }
 
+/**
+ * @brief Compute the coset FFTs of all queued FFT items with a single batched transform
+ * @details The batch shares thread dispatches and twiddle factors across the polynomials, which is cheaper than
+ * transforming them one at a time (see polynomial_arithmetic::coset_fft_batch).
+ */
+void work_queue::process_fft_items()
+{
+    std::vector<std::string> tags;
+    std::vector<polynomial> polys_fft;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type == WorkType::FFT) {
+            tags.push_back(item.tag);
+            polys_fft.emplace_back(key->polynomial_store.get(item.tag), 4 * key->circuit_size + 4);
+        }
+    }
+    if (polys_fft.empty()) {
+        return;
+    }
+
+    std::vector<fr*> poly_ptrs;
+    for (auto& poly_fft : polys_fft) {
+        poly_ptrs.push_back(poly_fft.data().get());
+    }
+    polynomial_arithmetic::coset_fft_batch(poly_ptrs, key->large_domain);
+
+    for (size_t j = 0; j < polys_fft.size(); ++j) {
+        for (size_t i = 0; i < 4; i++) {
+            polys_fft[j][4 * key->circuit_size + i] = polys_fft[j][i];
+        }
+        key->polynomial_store.put(tags[j] + "_fft", std::move(polys_fft[j]));
+    }
+}
+
 std::vector<work_queue::work_item> work_queue::get_queue() const
 {
     return work_item_queue;
@@ -95,6 +95,7 @@ EvaluationDomain<Fr>::EvaluationDomain(const EvaluationDomain& other)
     , generator(other.generator)
     , generator_inverse(other.generator_inverse)
     , four_inverse(other.four_inverse)
+    , fft_strategy(other.fft_strategy)
 {
     ASSERT((1UL << log2_size) == size);
     ASSERT((1UL << log2_thread_size) == thread_size);
@@ -132,6 +133,7 @@ EvaluationDomain<Fr>::EvaluationDomain(EvaluationDomain&& other)
     , generator(other.generator)
     , generator_inverse(other.generator_inverse)
     , four_inverse(other.four_inverse)
+    , fft_strategy(other.fft_strategy)
 {
     roots = other.roots;
     round_roots = std::move(other.round_roots);
@@ -155,6 +157,7 @@ template <typename Fr> EvaluationDomain<Fr>& EvaluationDomain<Fr>::operator=(Eva
     Fr::__copy(other.generator, generator);
     Fr::__copy(other.generator_inverse, generator_inverse);
     Fr::__copy(other.four_inverse, four_inverse);
+    fft_strategy = other.fft_strategy;
     roots = nullptr;
     if (other.roots != nullptr) {
         roots = other.roots;
@@ -5,6 +5,15 @@
 
 namespace bb {
 
+/**
+ * @brief Algorithm used by polynomial_arithmetic to compute FFTs over an EvaluationDomain
+ */
+enum class FFTStrategy {
+    RADIX_2, // One parallel pass over the whole array per round
+    BLOCKED, // Four-step decomposition into cache-resident sub-FFTs, two passes over the array. Used for domains of
+             // at least 2^12 elements; smaller domains fall back to RADIX_2
+};
+
 template <typename FF> class EvaluationDomain {
   public:
     EvaluationDomain()
@@ -55,6 +64,8 @@ template <typename FF> class EvaluationDomain {
     FF generator_inverse;
     FF four_inverse;
 
+    FFTStrategy fft_strategy = FFTStrategy::RADIX_2;
+
   private:
     std::vector<FF*> round_roots; // An entry for each of the log(n) rounds: each entry is a pointer to
                                   // the subset of the roots of unity required for that fft round.
@@ -376,9 +376,8 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] += scaling_factor * other[i];
-        }
+        Fr::batch_add_scaled(
+            { coefficients_ + offset, end - offset }, other.subspan(offset, end - offset), scaling_factor);
     });
 }
 
@@ -430,9 +429,7 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] *= scaling_factor;
-        }
+        Fr::batch_mul({ coefficients_ + offset, end - offset }, scaling_factor);
     });
 
     return *this;
@@ -5,6 +5,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -30,6 +31,42 @@ template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_
 #endif
 }
 
+// FFT rounds whose butterfly blocks are at least this large compute their twiddle products in bulk
+constexpr size_t BULK_BUTTERFLY_THRESHOLD = 16;
+
+/**
+ * @brief Apply the butterflies (even, odd) <- (even + root * odd, even - root * odd) over contiguous ranges
+ * @details The twiddle products are computed up front with Fr::batch_mul (overwriting `odd`), which can use the
+ * multi-lane field kernels.
+ */
+template <typename Fr> void butterfly_range(Fr* even, Fr* odd, const Fr* roots, const size_t range)
+{
+    Fr::batch_mul(std::span<Fr>{ odd, range }, std::span<const Fr>{ roots, range });
+    for (size_t i = 0; i < range; ++i) {
+        const Fr temp = odd[i];
+        odd[i] = even[i] - temp;
+        even[i] += temp;
+    }
+}
+
+/**
+ * @brief Apply the butterflies of one FFT round to the elements [start, end) of the flattened loop (see
+ * fft_inner_parallel), splitting the range into blocks that share contiguous roots
+ */
+template <typename Fr>
+void butterfly_round_bulk(Fr* target, const Fr* round_roots, const size_t m, const size_t start, const size_t end)
+{
+    const size_t block_mask = m - 1;
+    const size_t index_mask = ~block_mask;
+    for (size_t i = start; i < end;) {
+        const size_t k1 = (i & index_mask) << 1;
+        const size_t j1 = i & block_mask;
+        const size_t range = std::min(m - j1, end - i);
+        butterfly_range(&target[k1 + j1], &target[k1 + j1 + m], &round_roots[j1], range);
+        i += range;
+    }
+}
+
 } // namespace
 
 inline uint32_t reverse_bits(uint32_t x, uint32_t bit_length)
@@ -46,6 +83,145 @@ inline bool is_power_of_two(uint64_t x)
     return x && !(x & (x - 1));
 }
 
+namespace {
+
+// Domains smaller than this are always transformed with the radix-2 engine: they fit in cache anyway
+constexpr size_t MIN_BLOCKED_FFT_SIZE = 1 << 12;
+// Number of adjacent columns the blocked FFT gathers at a time (8 field elements = 4 cache lines)
+constexpr size_t BLOCKED_FFT_COLUMNS = 8;
+
+/**
+ * @brief Serial in-place FFT of a contiguous array, natural order in and out
+ * @details The array size must divide the domain size; a transform of size m uses the first log2(m) - 1 rounds of the
+ * domain's root table (round i holds the powers of the primitive 2^{i + 2}'th root of unity, whatever the domain size).
+ */
+template <typename Fr> void fft_contiguous(Fr* coeffs, const size_t size, const std::vector<Fr*>& root_table)
+{
+    const auto log2_size = static_cast<uint32_t>(numeric::get_msb(size));
+    for (size_t i = 0; i < size; ++i) {
+        const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), log2_size);
+        if (i < swap_index) {
+            std::swap(coeffs[i], coeffs[swap_index]);
+        }
+    }
+    for (size_t i = 0; i < size; i += 2) {
+        const Fr temp = coeffs[i + 1];
+        coeffs[i + 1] = coeffs[i] - temp;
+        coeffs[i] += temp;
+    }
+    for (size_t m = 2; m < size; m <<= 1) {
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        for (size_t k = 0; k < size; k += 2 * m) {
+            if (m >= BULK_BUTTERFLY_THRESHOLD) {
+                butterfly_range(&coeffs[k], &coeffs[k + m], round_roots, m);
+                continue;
+            }
+            for (size_t j = 0; j < m; ++j) {
+                const Fr temp = round_roots[j] * coeffs[k + j + m];
+                coeffs[k + j + m] = coeffs[k + j] - temp;
+                coeffs[k + j] += temp;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Cache-blocked ("four-step") FFT
+ * @details Let n = n1 * n2. Writing input indices as j = j1 + n1 * j2 and output indices as k = k2 + n2 * k1,
+ *
+ *      X[k] = Σ_{j1} ω^{n2 * j1 * k1} * ω^{j1 * k2} * ( Σ_{j2} ω^{n1 * j2 * k2} * x[j1 + n1 * j2] )
+ *
+ * so the transform is n1 FFTs of size n2 over the (strided) columns of x viewed as an n2 x n1 matrix, a twiddle
+ * multiplication by ω^{j1 * k2}, then n2 FFTs of size n1 over the columns of the intermediate n1 x n2 matrix, the
+ * results of which land directly in natural order. Each thread gathers BLOCKED_FFT_COLUMNS columns at a time into a
+ * local buffer, so the sub-FFTs (and their bit-reversal permutations) run in cache and the full-size arrays are only
+ * streamed twice, compared with once per round for the radix-2 engine.
+ *
+ * Polynomials split over several equally-sized pieces are supported as in fft_inner_parallel. `input` and `output` may
+ * coincide.
+ *
+ * @param root The root of unity of the transform (the domain's root or root_inverse, matching root_table)
+ */
+template <typename Fr>
+void fft_blocked(const std::vector<Fr*>& input,
+                 const std::vector<Fr*>& output,
+                 const EvaluationDomain<Fr>& domain,
+                 const Fr& root,
+                 const std::vector<Fr*>& root_table)
+{
+    ASSERT(input.size() == output.size());
+    const size_t log2_n2 = domain.log2_size / 2;
+    const size_t n2 = 1UL << log2_n2;
+    const size_t n1 = domain.size >> log2_n2;
+    const size_t log2_poly_size = domain.log2_size - static_cast<size_t>(numeric::get_msb(input.size()));
+    const size_t poly_mask = (1UL << log2_poly_size) - 1;
+
+    auto intermediate_ptr = get_scratch_space<Fr>(domain.size);
+    Fr* intermediate = intermediate_ptr.get();
+
+    // Run `process_block(local_buffer, first_column)` over the `num_columns / BLOCKED_FFT_COLUMNS` column blocks
+    const auto for_each_column_block = [&](const size_t num_columns, const auto& process_block) {
+        const size_t num_blocks = num_columns / BLOCKED_FFT_COLUMNS;
+        const size_t num_threads = std::min(domain.num_threads, num_blocks);
+        const size_t blocks_per_thread = num_blocks / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto local_ptr =
+                std::static_pointer_cast<Fr[]>(get_mem_slab(BLOCKED_FFT_COLUMNS * std::max(n1, n2) * sizeof(Fr)));
+            for (size_t block = thread_idx * blocks_per_thread; block < (thread_idx + 1) * blocks_per_thread;
+                 ++block) {
+                process_block(local_ptr.get(), block * BLOCKED_FFT_COLUMNS);
+            }
+        });
+    };
+
+    // Step 1: size-n2 FFTs over the columns j1 of x, followed by the twiddle multiplication. Row j1 of the
+    // intermediate matrix holds the result for column j1.
+    for_each_column_block(n1, [&](Fr* local, const size_t first_column) {
+        for (size_t j2 = 0; j2 < n2; ++j2) {
+            for (size_t c = 0; c < BLOCKED_FFT_COLUMNS; ++c) {
+                const size_t index = j2 * n1 + first_column + c;
+                local[c * n2 + j2] = input[index >> log2_poly_size][index & poly_mask];
+            }
+        }
+        std::array<Fr, BLOCKED_FFT_COLUMNS> twiddle_steps;
+        std::array<Fr, BLOCKED_FFT_COLUMNS> twiddles;
+        for (size_t c = 0; c < BLOCKED_FFT_COLUMNS; ++c) {
+            fft_contiguous(&local[c * n2], n2, root_table);
+            twiddle_steps[c] = root.pow(static_cast<uint64_t>(first_column + c));
+            twiddles[c] = Fr::one();
+        }
+        for (size_t k2 = 0; k2 < n2; ++k2) {
+            for (size_t c = 0; c < BLOCKED_FFT_COLUMNS; ++c) {
+                local[c * n2 + k2] *= twiddles[c];
+                twiddles[c] *= twiddle_steps[c];
+            }
+        }
+        memcpy(static_cast<void*>(&intermediate[first_column * n2]),
+               static_cast<void*>(local),
+               BLOCKED_FFT_COLUMNS * n2 * sizeof(Fr));
+    });
+
+    // Step 2: size-n1 FFTs over the columns k2 of the intermediate matrix; X[k2 + n2 * k1] is entry k1 of column k2
+    for_each_column_block(n2, [&](Fr* local, const size_t first_column) {
+        for (size_t j1 = 0; j1 < n1; ++j1) {
+            for (size_t c = 0; c < BLOCKED_FFT_COLUMNS; ++c) {
+                local[c * n1 + j1] = intermediate[j1 * n2 + first_column + c];
+            }
+        }
+        for (size_t c = 0; c < BLOCKED_FFT_COLUMNS; ++c) {
+            fft_contiguous(&local[c * n1], n1, root_table);
+        }
+        for (size_t k1 = 0; k1 < n1; ++k1) {
+            for (size_t c = 0; c < BLOCKED_FFT_COLUMNS; ++c) {
+                const size_t index = k1 * n2 + first_column + c;
+                output[index >> log2_poly_size][index & poly_mask] = local[c * n1 + k1];
+            }
+        }
+    });
+}
+
+} // namespace
+
 template <typename Fr>
 void copy_polynomial(const Fr* src, Fr* dest, size_t num_src_coefficients, size_t num_target_coefficients)
 {
@@ -172,9 +348,14 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const EvaluationDomain<Fr>& domain,
-                        const Fr&,
+                        const Fr& root,
                         const std::vector<Fr*>& root_table)
 {
+    if (domain.fft_strategy == FFTStrategy::BLOCKED && domain.size >= MIN_BLOCKED_FFT_SIZE) {
+        fft_blocked(coeffs, coeffs, domain, root, root_table);
+        return;
+    }
+
     auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
     auto scratch_space = scratch_space_ptr.get();
 
@@ -270,14 +451,25 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
             if (m != (domain.size >> 1)) {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                    scratch_space[k1 + j1] += temp;
+                if (m >= BULK_BUTTERFLY_THRESHOLD) {
+                    butterfly_round_bulk(scratch_space, round_roots, m, start, end);
+                } else {
+                    for (size_t i = start; i < end; ++i) {
+                        size_t k1 = (i & index_mask) << 1;
+                        size_t j1 = i & block_mask;
+                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
+                        scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
+                        scratch_space[k1 + j1] += temp;
+                    }
                 }
             } else {
+                // In the final round k1 is always 0, so this thread's odd entries are contiguous and we can compute
+                // all of their twiddle products up front
+                const bool bulk = m >= BULK_BUTTERFLY_THRESHOLD;
+                if (bulk) {
+                    Fr::batch_mul(std::span<Fr>{ &scratch_space[start + m], end - start },
+                                  std::span<const Fr>{ &round_roots[start], end - start });
+                }
                 for (size_t i = start; i < end; ++i) {
                     size_t k1 = (i & index_mask) << 1;
                     size_t j1 = i & block_mask;
@@ -287,7 +479,7 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                     size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
                     size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
 
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
+                    temp = bulk ? scratch_space[k1 + j1 + m] : round_roots[j1] * scratch_space[k1 + j1 + m];
                     coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
                     coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
                 }
@@ -299,8 +491,13 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(
-    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
+    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr& root, const std::vector<Fr*>& root_table)
 {
+    if (domain.fft_strategy == FFTStrategy::BLOCKED && domain.size >= MIN_BLOCKED_FFT_SIZE) {
+        fft_blocked<Fr>({ coeffs }, { target }, domain, root, root_table);
+        return;
+    }
+
     parallel_for(domain.num_threads, [&](size_t j) {
         Fr temp_1;
         Fr temp_2;
@@ -380,6 +577,10 @@ void fft_inner_parallel(
             // Finally, we want to treat the final round differently from the others,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
+            if (m >= BULK_BUTTERFLY_THRESHOLD) {
+                butterfly_round_bulk(target, round_roots, m, start, end);
+                return;
+            }
             for (size_t i = start; i < end; ++i) {
                 size_t k1 = (i & index_mask) << 1;
                 size_t j1 = i & block_mask;
@@ -622,6 +823,120 @@ void coset_fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     fft(coeffs, domain);
 }
 
+namespace {
+
+// Number of butterflies (or coset scalings) a thread applies to every polynomial of a batch before moving on, so that
+// the twiddles it loads stay in L1 across the batch
+constexpr size_t FFT_BATCH_TILE_SIZE = 1 << 8;
+
+/**
+ * @brief In-place FFT of several independent polynomials over the same domain
+ * @details The radix-2 engine of fft_inner_parallel, except that the bit-reversal and each round are dispatched to the
+ * threads once for the whole batch, and each thread walks its share of a round in tiles, applying the tile's twiddles
+ * to every polynomial before loading the next ones. For a batch of k polynomials this replaces k * log(n) thread
+ * dispatches with log(n), and k twiddle streams per round with one.
+ */
+template <typename Fr>
+void fft_batch_inner_parallel(const std::vector<Fr*>& polys,
+                              const EvaluationDomain<Fr>& domain,
+                              const std::vector<Fr*>& root_table)
+{
+    parallel_for(domain.num_threads, [&](size_t j) {
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); ++i) {
+            const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(domain.log2_size));
+            if (i < swap_index) {
+                for (Fr* poly : polys) {
+                    std::swap(poly[i], poly[swap_index]);
+                }
+            }
+        }
+    });
+
+    for (size_t m = 1; m < domain.size; m <<= 1) {
+        parallel_for(domain.num_threads, [&](size_t j) {
+            // See fft_inner_parallel for the indexing of the flattened butterfly loop
+            const size_t start = j * (domain.thread_size >> 1);
+            const size_t end = (j + 1) * (domain.thread_size >> 1);
+            const size_t block_mask = m - 1;
+            const size_t index_mask = ~block_mask;
+
+            // The roots of the first round are all 1
+            if (m == 1) {
+                for (Fr* poly : polys) {
+                    for (size_t i = start; i < end; ++i) {
+                        const Fr temp = poly[2 * i + 1];
+                        poly[2 * i + 1] = poly[2 * i] - temp;
+                        poly[2 * i] += temp;
+                    }
+                }
+                return;
+            }
+
+            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+            for (size_t tile_start = start; tile_start < end; tile_start += FFT_BATCH_TILE_SIZE) {
+                const size_t tile_end = std::min(tile_start + FFT_BATCH_TILE_SIZE, end);
+                if (m >= BULK_BUTTERFLY_THRESHOLD) {
+                    for (Fr* poly : polys) {
+                        butterfly_round_bulk(poly, round_roots, m, tile_start, tile_end);
+                    }
+                    continue;
+                }
+                for (size_t i = tile_start; i < tile_end; ++i) {
+                    const size_t k1 = (i & index_mask) << 1;
+                    const size_t j1 = i & block_mask;
+                    const Fr& root = round_roots[j1];
+                    for (Fr* poly : polys) {
+                        const Fr temp = root * poly[k1 + j1 + m];
+                        poly[k1 + j1 + m] = poly[k1 + j1] - temp;
+                        poly[k1 + j1] += temp;
+                    }
+                }
+            }
+        });
+    }
+}
+
+} // namespace
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    // The blocked engine already streams each polynomial only twice; batching buys it nothing
+    if (domain.fft_strategy == FFTStrategy::BLOCKED && domain.size >= MIN_BLOCKED_FFT_SIZE) {
+        for (Fr* poly : polys) {
+            fft(poly, domain);
+        }
+        return;
+    }
+    fft_batch_inner_parallel(polys, domain, domain.get_round_roots());
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    // Scale coefficient i of every polynomial by g^i, computing each tile of powers of g once for the whole batch
+    const size_t thread_size = domain.generator_size / domain.num_threads;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        std::array<Fr, FFT_BATCH_TILE_SIZE> powers;
+        const size_t offset = j * thread_size;
+        Fr work_generator = domain.generator.pow(static_cast<uint64_t>(offset));
+        for (size_t tile_start = offset; tile_start < offset + thread_size; tile_start += FFT_BATCH_TILE_SIZE) {
+            const size_t tile_size = std::min(FFT_BATCH_TILE_SIZE, offset + thread_size - tile_start);
+            for (size_t i = 0; i < tile_size; ++i) {
+                powers[i] = work_generator;
+                work_generator *= domain.generator;
+            }
+            for (Fr* poly : polys) {
+                Fr::batch_mul(std::span<Fr>{ &poly[tile_start], tile_size },
+                              std::span<const Fr>{ powers.data(), tile_size });
+            }
+        }
+    });
+    fft_batch(polys, domain);
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(Fr* coeffs,
@@ -1379,6 +1694,8 @@ template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&, const size_t);
+template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void coset_fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void ifft<fr>(fr*, const EvaluationDomain<fr>&);
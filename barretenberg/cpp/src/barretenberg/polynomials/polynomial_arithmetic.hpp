@@ -67,6 +67,16 @@ void coset_fft(Fr* coeffs,
                const EvaluationDomain<Fr>& large_domain,
                const size_t domain_extension);
 
+// Transform several independent polynomials over the same domain in place. Unlike the std::vector<Fr*> overloads
+// above, which treat the pointers as consecutive pieces of a single polynomial, each pointer here is a polynomial of
+// size domain.size. Equivalent to calling fft / coset_fft on each, but the batch shares thread dispatches and twiddles.
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& constant);
@@ -186,6 +186,87 @@ TEST(polynomials, split_polynomial_fft_ifft_consistency)
     }
 }
 
+TEST(polynomials, blocked_fft_matches_radix_2)
+{
+    // log2(n) odd, so that the four-step decomposition is not square
+    constexpr size_t n = 1 << 13;
+    constexpr size_t num_poly = 4;
+    std::vector<fr> coefficients(n);
+    for (auto& coeff : coefficients) {
+        coeff = fr::random_element();
+    }
+
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+    auto blocked_domain = evaluation_domain(n);
+    blocked_domain.compute_lookup_table();
+    blocked_domain.fft_strategy = FFTStrategy::BLOCKED;
+
+    // in place
+    auto expected = coefficients;
+    auto result = coefficients;
+    polynomial_arithmetic::fft(expected.data(), domain);
+    polynomial_arithmetic::fft(result.data(), blocked_domain);
+    EXPECT_EQ(result, expected);
+
+    // out of place
+    std::vector<fr> target(n);
+    polynomial_arithmetic::fft(coefficients.data(), target.data(), blocked_domain);
+    EXPECT_EQ(target, expected);
+
+    // inverse
+    polynomial_arithmetic::ifft(result.data(), blocked_domain);
+    EXPECT_EQ(result, coefficients);
+
+    // polynomial split over several pieces
+    expected = coefficients;
+    result = coefficients;
+    std::vector<fr*> expected_pieces;
+    std::vector<fr*> result_pieces;
+    for (size_t j = 0; j < num_poly; j++) {
+        expected_pieces.push_back(&expected[j * (n / num_poly)]);
+        result_pieces.push_back(&result[j * (n / num_poly)]);
+    }
+    polynomial_arithmetic::coset_fft(expected_pieces, domain);
+    polynomial_arithmetic::coset_fft(result_pieces, blocked_domain);
+    EXPECT_EQ(result, expected);
+}
+
+TEST(polynomials, batched_fft_matches_fft)
+{
+    constexpr size_t num_polys = 5;
+    for (const size_t n : { 2UL, 32UL, 1UL << 11 }) {
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<std::vector<fr>> polys(num_polys, std::vector<fr>(n));
+        for (auto& poly : polys) {
+            for (auto& coeff : poly) {
+                coeff = fr::random_element();
+            }
+        }
+        auto coset_polys = polys;
+        std::vector<fr*> poly_ptrs;
+        std::vector<fr*> coset_poly_ptrs;
+        for (size_t j = 0; j < num_polys; ++j) {
+            poly_ptrs.push_back(polys[j].data());
+            coset_poly_ptrs.push_back(coset_polys[j].data());
+        }
+
+        auto expected = polys;
+        auto expected_coset = polys;
+        for (size_t j = 0; j < num_polys; ++j) {
+            polynomial_arithmetic::fft(expected[j].data(), domain);
+            polynomial_arithmetic::coset_fft(expected_coset[j].data(), domain);
+        }
+        polynomial_arithmetic::fft_batch(poly_ptrs, domain);
+        polynomial_arithmetic::coset_fft_batch(coset_poly_ptrs, domain);
+
+        EXPECT_EQ(polys, expected);
+        EXPECT_EQ(coset_polys, expected_coset);
+    }
+}
+
 TEST(polynomials, fft_coset_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -217,6 +217,38 @@ void coset_fft_bench_parallel(State& state) noexcept
 }
 BENCHMARK(coset_fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+// Coset FFTs of a batch of 4 polynomials (e.g. the wires of a width-4 circuit), one at a time and batched
+constexpr size_t FFT_BATCH_SIZE = 4;
+
+void coset_fft_bench_individual(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    size_t idx = (size_t)numeric::get_msb((uint64_t)n) - (size_t)numeric::get_msb(START);
+    for (auto _ : state) {
+        for (size_t j = 0; j < FFT_BATCH_SIZE; ++j) {
+            bb::polynomial_arithmetic::coset_fft(&globals.data[j * n], evaluation_domains[idx]);
+        }
+    }
+}
+BENCHMARK(coset_fft_bench_individual)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond);
+
+void coset_fft_bench_batched(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    size_t idx = (size_t)numeric::get_msb((uint64_t)n) - (size_t)numeric::get_msb(START);
+    std::vector<fr*> polys;
+    for (size_t j = 0; j < FFT_BATCH_SIZE; ++j) {
+        polys.push_back(&globals.data[j * n]);
+    }
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::coset_fft_batch(polys, evaluation_domains[idx]);
+    }
+}
+BENCHMARK(coset_fft_bench_batched)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
 void alternate_coset_fft_bench_parallel(State& state) noexcept
 {
     for (auto _ : state) {
@@ -238,6 +270,28 @@ void fft_bench_parallel(State& state) noexcept
 }
 BENCHMARK(fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+void coset_fft_bench_blocked(State& state) noexcept
+{
+    size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+    evaluation_domains[idx].fft_strategy = bb::FFTStrategy::BLOCKED;
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::coset_fft(globals.data, evaluation_domains[idx]);
+    }
+    evaluation_domains[idx].fft_strategy = bb::FFTStrategy::RADIX_2;
+}
+BENCHMARK(coset_fft_bench_blocked)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
+void fft_bench_blocked(State& state) noexcept
+{
+    size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+    evaluation_domains[idx].fft_strategy = bb::FFTStrategy::BLOCKED;
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::fft(globals.data, evaluation_domains[idx]);
+    }
+    evaluation_domains[idx].fft_strategy = bb::FFTStrategy::RADIX_2;
+}
+BENCHMARK(fft_bench_blocked)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
 void fft_bench_serial(State& state) noexcept
 {
     for (auto _ : state) {
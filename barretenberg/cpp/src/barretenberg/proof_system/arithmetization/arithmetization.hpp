@@ -106,6 +106,7 @@ template <typename FF_> class Ultra {
     const SelectorType& q_lookup_type() const { return selectors[10]; };
 
     const auto& get() const { return selectors; };
+    auto& get() { return selectors; };
 
     void reserve(size_t size_hint)
     {
@@ -175,6 +176,7 @@ template <typename FF_> class UltraHonk {
     const SelectorType& q_poseidon2_internal() const { return this->selectors[13]; };
 
     const auto& get() const { return selectors; };
+    auto& get() { return selectors; };
 
     void reserve(size_t size_hint)
     {
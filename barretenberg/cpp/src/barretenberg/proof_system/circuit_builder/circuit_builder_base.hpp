@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/proof_system/arithmetization/arithmetization.hpp"
@@ -11,6 +12,15 @@
 namespace bb {
 static constexpr uint32_t DUMMY_TAG = 0;
 
+/**
+ * @brief The number of gates and variables a circuit's builder grew to, recorded from one build of the circuit so that
+ * the next build can reserve them upfront
+ */
+struct CircuitSizeProfile {
+    size_t num_gates = 0;
+    size_t num_variables = 0;
+};
+
 template <typename FF_> class CircuitBuilderBase {
   public:
     using FF = FF_;
@@ -18,17 +28,20 @@ template <typename FF_> class CircuitBuilderBase {
 
     size_t num_gates = 0;
 
+    using VariableVector = std::vector<FF, ContainerSlabAllocator<FF>>;
+    using IndexVector = std::vector<uint32_t, ContainerSlabAllocator<uint32_t>>;
+
     std::vector<uint32_t> public_inputs;
-    std::vector<FF> variables;
+    VariableVector variables;
     std::unordered_map<uint32_t, std::string> variable_names;
 
     // index of next variable in equivalence class (=REAL_VARIABLE if you're last)
-    std::vector<uint32_t> next_var_index;
+    IndexVector next_var_index;
     // index of  previous variable in equivalence class (=FIRST if you're in a cycle alone)
-    std::vector<uint32_t> prev_var_index;
+    IndexVector prev_var_index;
     // indices of corresponding real variables
-    std::vector<uint32_t> real_variable_index;
-    std::vector<uint32_t> real_variable_tags;
+    IndexVector real_variable_index;
+    IndexVector real_variable_tags;
     uint32_t current_tag = DUMMY_TAG;
     // The permutation on variable tags. See
     // https://github.com/AztecProtocol/plonk-with-lookups-private/blob/new-stuff/GenPermuations.pdf
@@ -44,14 +57,25 @@ template <typename FF_> class CircuitBuilderBase {
     static constexpr uint32_t REAL_VARIABLE = UINT32_MAX - 1;
     static constexpr uint32_t FIRST_VARIABLE_IN_CLASS = UINT32_MAX - 2;
 
-    CircuitBuilderBase(size_t size_hint = 0)
+    /**
+     * @param size_hint the expected number of gates, of which there are assumed to be three variables each
+     * @param profile the sizes of a previous build of the circuit, which take precedence over size_hint if given
+     * @param arena an arena to allocate the variables from, which must outlive the builder
+     */
+    CircuitBuilderBase(size_t size_hint = 0, const CircuitSizeProfile& profile = {}, Arena* arena = nullptr)
+        : variables(ContainerSlabAllocator<FF>(arena))
+        , next_var_index(ContainerSlabAllocator<uint32_t>(arena))
+        , prev_var_index(ContainerSlabAllocator<uint32_t>(arena))
+        , real_variable_index(ContainerSlabAllocator<uint32_t>(arena))
+        , real_variable_tags(ContainerSlabAllocator<uint32_t>(arena))
     {
-        variables.reserve(size_hint * 3);
+        const size_t num_variables = profile.num_variables > 0 ? profile.num_variables : size_hint * 3;
+        variables.reserve(num_variables);
         variable_names.reserve(size_hint * 3);
-        next_var_index.reserve(size_hint * 3);
-        prev_var_index.reserve(size_hint * 3);
-        real_variable_index.reserve(size_hint * 3);
-        real_variable_tags.reserve(size_hint * 3);
+        next_var_index.reserve(num_variables);
+        prev_var_index.reserve(num_variables);
+        real_variable_index.reserve(num_variables);
+        real_variable_tags.reserve(num_variables);
     }
 
     CircuitBuilderBase(const CircuitBuilderBase& other) = default;
@@ -6,7 +6,10 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
+#include <limits>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -112,6 +115,358 @@ void UltraCircuitBuilder_<Arithmetization>::add_gates_to_ensure_all_polys_are_no
         plookup::MultiTableId::HONK_DUMMY_MULTI, dummy_accumulators, left_witness_index, right_witness_index);
 }
 
+/**
+ * @brief Create a copy of the builder without its gates, in which to build constraints apart from it
+ *
+ * @details The copy keeps the variables, constants, range lists and lookup tables of the builder, so that constraints
+ * built in it come out as they would in the builder itself. Its gates are then added back to the builder with
+ * splice_sub_builder, which is what allows independent constraints to be built on separate threads.
+ */
+template <typename Arithmetization>
+UltraCircuitBuilder_<Arithmetization> UltraCircuitBuilder_<Arithmetization>::create_sub_builder() const
+{
+    UltraCircuitBuilder_ sub_builder;
+    static_cast<CircuitBuilderBase<FF>&>(sub_builder) = *this;
+    for (auto& wire : sub_builder.wires) {
+        wire.clear();
+    }
+    for (auto& selector : sub_builder.selectors.get()) {
+        selector.clear();
+    }
+    sub_builder.constant_variable_indices = constant_variable_indices;
+    sub_builder.lookup_tables = lookup_tables;
+    sub_builder.lookup_multi_tables = lookup_multi_tables;
+    sub_builder.range_lists = range_lists;
+    sub_builder.ram_arrays = ram_arrays;
+    sub_builder.rom_arrays = rom_arrays;
+    sub_builder.memory_read_records = memory_read_records;
+    sub_builder.memory_write_records = memory_write_records;
+    sub_builder.cached_partial_non_native_field_multiplications = cached_partial_non_native_field_multiplications;
+    sub_builder.circuit_finalized = circuit_finalized;
+    return sub_builder;
+}
+
+/**
+ * @brief Append the gates and variables of a sub-builder to the builder, as if they had been built in it directly
+ *
+ * @details `base` is the builder as it was when the sub-builder was created from it with create_sub_builder, and the
+ * builder may have gained constraints since. The variables the sub-builder added are renumbered after the builder's,
+ * and its tags and lookup table indices are mapped to the builder's. Constants and range lists the builder has gained
+ * in the meantime are shared: the sub-builder's copies, and the gates that created them, are dropped, which is exactly
+ * what building the constraints in the builder would have done. The result is the same circuit, down to the variable
+ * indices, as building the sub-builder's constraints in the builder after the ones it already has.
+ *
+ * That holds as long as the sub-builder's constraints do not depend on anything the builder has changed since `base`.
+ * If the sub-builder uses a variable of `base` whose copy constraints (or, unless they end up the same, range tags)
+ * have changed in the builder, or if it touches ROM/RAM, public inputs or recursion, the builder is left untouched and
+ * false is returned, and the constraints have to be built in the builder instead.
+ *
+ * @return Whether the sub-builder was spliced in
+ */
+template <typename Arithmetization>
+bool UltraCircuitBuilder_<Arithmetization>::splice_sub_builder(const UltraCircuitBuilder_& sub_builder,
+                                                               const UltraCircuitBuilder_& base)
+{
+    const auto& sub = sub_builder;
+    // ROM/RAM records refer to gate indices, and public inputs and recursion to the circuit as a whole
+    if (sub.rom_arrays != base.rom_arrays || sub.ram_arrays != base.ram_arrays ||
+        sub.memory_read_records.size() != base.memory_read_records.size() ||
+        sub.memory_write_records.size() != base.memory_write_records.size() ||
+        sub.public_inputs != base.public_inputs || sub.contains_recursive_proof != base.contains_recursive_proof) {
+        return false;
+    }
+
+    const auto num_base_variables = static_cast<uint32_t>(base.variables.size());
+    const size_t num_new_variables = sub.variables.size() - num_base_variables;
+    const size_t num_sub_gates = sub.w_l().size();
+    constexpr auto UNASSIGNED = std::numeric_limits<uint32_t>::max();
+
+    // The index in the builder of each variable added by the sub-builder. Constants the builder already has are mapped
+    // here, the variables to keep once they are added to the builder, and the variables to drop are left unassigned
+    std::vector<uint32_t> new_indices(num_new_variables, UNASSIGNED);
+    std::vector<bool> dropped_variables(num_new_variables, false);
+    std::vector<bool> dropped_gates(num_sub_gates, false);
+    const auto to_builder_index = [&](const uint32_t index) {
+        if (index < num_base_variables) {
+            return index;
+        }
+        ASSERT(new_indices[index - num_base_variables] != UNASSIGNED);
+        return new_indices[index - num_base_variables];
+    };
+
+    // The first gate of each new variable in w_l, which is the gate that created it for constants and range lists
+    std::vector<size_t> first_gates(num_new_variables, num_sub_gates);
+    for (size_t i = num_sub_gates; i-- > 0;) {
+        if (sub.w_l()[i] >= num_base_variables) {
+            first_gates[sub.w_l()[i] - num_base_variables] = i;
+        }
+    }
+
+    std::vector<std::pair<FF, uint32_t>> new_constants;
+    std::vector<uint32_t> shared_constants;
+    std::vector<bool> shared_constant_flags(num_new_variables, false);
+    for (const auto& [value, index] : sub.constant_variable_indices) {
+        if (index < num_base_variables) {
+            continue;
+        }
+        if (auto it = constant_variable_indices.find(value); it != constant_variable_indices.end()) {
+            new_indices[index - num_base_variables] = it->second;
+            dropped_gates[first_gates[index - num_base_variables]] = true;
+            shared_constants.emplace_back(index);
+            shared_constant_flags[index - num_base_variables] = true;
+        } else {
+            new_constants.emplace_back(value, index);
+        }
+    }
+
+    // Range lists created by the sub-builder, in the order it created them. The tags of those the builder already has
+    // map to the builder's; the others get new tags once the sub-builder is known to splice
+    std::vector<const RangeList*> new_range_lists;
+    std::map<uint32_t, uint32_t> new_tags;
+    for (const auto& [target_range, list] : sub.range_lists) {
+        if (base.range_lists.contains(target_range)) {
+            continue;
+        }
+        new_range_lists.emplace_back(&list);
+        auto it = range_lists.find(target_range);
+        if (it == range_lists.end()) {
+            continue;
+        }
+        new_tags[list.range_tag] = it->second.range_tag;
+        new_tags[list.tau_tag] = it->second.tau_tag;
+        const size_t num_list_variables = target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        for (size_t i = 0; i < num_list_variables; ++i) {
+            dropped_variables[list.variable_indices[i] - num_base_variables] = true;
+        }
+        const size_t first_gate = first_gates[list.variable_indices[0] - num_base_variables];
+        for (size_t i = 0; i < (num_list_variables + NUM_WIRES - 1) / NUM_WIRES; ++i) {
+            dropped_gates[first_gate + i] = true;
+        }
+    }
+    std::sort(new_range_lists.begin(), new_range_lists.end(), [](const RangeList* lhs, const RangeList* rhs) {
+        return lhs->range_tag < rhs->range_tag;
+    });
+    const auto to_builder_tag = [&](const uint32_t tag) {
+        if (tag <= base.current_tag) {
+            return tag;
+        }
+        auto it = new_tags.find(tag);
+        return it == new_tags.end() ? UNASSIGNED : it->second;
+    };
+
+    // Whether the copy cycle of a variable (and its tag, if compare_tag is set) in `builder` is still as in the base
+    // builder. A variable the base builder does not have was created on its own and untagged.
+    const auto matches_base = [&](const UltraCircuitBuilder_& builder, const uint32_t index, const bool compare_tag) {
+        if (index >= num_base_variables) {
+            return builder.next_var_index[index] == this->REAL_VARIABLE &&
+                   builder.prev_var_index[index] == this->FIRST_VARIABLE_IN_CLASS &&
+                   builder.real_variable_index[index] == index &&
+                   (!compare_tag || builder.real_variable_tags[index] == DUMMY_TAG);
+        }
+        uint32_t member = base.get_first_variable_in_class(index);
+        while (true) {
+            if (builder.next_var_index[member] != base.next_var_index[member] ||
+                builder.prev_var_index[member] != base.prev_var_index[member] ||
+                builder.real_variable_index[member] != base.real_variable_index[member]) {
+                return false;
+            }
+            if (base.next_var_index[member] == this->REAL_VARIABLE) {
+                break;
+            }
+            member = base.next_var_index[member];
+        }
+        return !compare_tag || builder.real_variable_tags[builder.real_variable_index[index]] ==
+                                   base.real_variable_tags[base.real_variable_index[index]];
+    };
+    // Whether the sub-builder's constraints on a variable it shares with the builder hold up against the builder's
+    // version of it. A tag the builder has since given the variable is fine if the sub-builder gave it the same one,
+    // in which case the builder would have skipped the range constraint.
+    const auto shares_with_builder = [&](const uint32_t sub_index, const uint32_t index) {
+        if (!matches_base(*this, index, false)) {
+            return false;
+        }
+        if (matches_base(*this, index, true)) {
+            return true;
+        }
+        const uint32_t sub_tag = sub.real_variable_tags[sub.real_variable_index[sub_index]];
+        return matches_base(sub, sub_index, false) &&
+               (sub_tag == DUMMY_TAG ||
+                to_builder_tag(sub_tag) == this->real_variable_tags[this->real_variable_index[index]]);
+    };
+
+    // Check every variable of the base builder that the sub-builder refers to or changes, and the shared constants
+    enum class Shared : uint8_t { UNCHECKED, YES, NO };
+    std::vector<Shared> shared(num_base_variables, Shared::UNCHECKED);
+    const auto check_shared = [&](const uint32_t sub_index) {
+        if (sub_index >= num_base_variables) {
+            return true;
+        }
+        if (shared[sub_index] == Shared::UNCHECKED) {
+            shared[sub_index] = shares_with_builder(sub_index, sub_index) ? Shared::YES : Shared::NO;
+        }
+        return shared[sub_index] == Shared::YES;
+    };
+    std::vector<uint32_t> changed_variables;
+    for (uint32_t i = 0; i < num_base_variables; ++i) {
+        if (sub.next_var_index[i] != base.next_var_index[i] || sub.prev_var_index[i] != base.prev_var_index[i] ||
+            sub.real_variable_index[i] != base.real_variable_index[i] ||
+            sub.real_variable_tags[i] != base.real_variable_tags[i]) {
+            if (!check_shared(i)) {
+                return false;
+            }
+            changed_variables.emplace_back(i);
+        }
+    }
+    for (const uint32_t index : shared_constants) {
+        if (!shares_with_builder(index, to_builder_index(index))) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < num_sub_gates; ++i) {
+        for (const auto& wire : sub.wires) {
+            if (!dropped_gates[i] && !check_shared(wire[i])) {
+                return false;
+            }
+        }
+    }
+    const size_t num_base_multiplications = base.cached_partial_non_native_field_multiplications.size();
+    for (size_t i = num_base_multiplications; i < sub.cached_partial_non_native_field_multiplications.size(); ++i) {
+        const auto& multiplication = sub.cached_partial_non_native_field_multiplications[i];
+        for (size_t j = 0; j < 5; ++j) {
+            if (!check_shared(multiplication.a[j]) || !check_shared(multiplication.b[j])) {
+                return false;
+            }
+        }
+    }
+
+    // Range constraints added to the lists by the sub-builder, except those on variables the builder has since put in
+    // the same list
+    std::vector<std::pair<uint64_t, uint32_t>> range_constrained_variables;
+    for (const auto& [target_range, list] : sub.range_lists) {
+        auto base_list = base.range_lists.find(target_range);
+        const size_t start = base_list != base.range_lists.end()
+                                 ? base_list->second.variable_indices.size()
+                                 : target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        for (size_t i = start; i < list.variable_indices.size(); ++i) {
+            const uint32_t sub_index = list.variable_indices[i];
+            if (!check_shared(sub_index)) {
+                return false;
+            }
+            if (sub_index < num_base_variables || new_indices[sub_index - num_base_variables] != UNASSIGNED) {
+                const uint32_t index = to_builder_index(sub_index);
+                if (this->real_variable_tags[this->real_variable_index[index]] == to_builder_tag(list.range_tag)) {
+                    continue;
+                }
+            }
+            range_constrained_variables.emplace_back(target_range, sub_index);
+        }
+    }
+
+    // The sub-builder splices. Add its variables, then its range lists in the order it created them.
+    for (size_t i = 0; i < num_new_variables; ++i) {
+        if (!dropped_variables[i] && new_indices[i] == UNASSIGNED) {
+            new_indices[i] = this->add_variable(sub.variables[num_base_variables + i]);
+        }
+    }
+    for (const RangeList* list : new_range_lists) {
+        if (range_lists.contains(list->target_range)) {
+            continue;
+        }
+        RangeList result;
+        result.target_range = list->target_range;
+        result.range_tag = get_new_tag();
+        result.tau_tag = get_new_tag();
+        create_tag(result.range_tag, result.tau_tag);
+        create_tag(result.tau_tag, result.range_tag);
+        new_tags[list->range_tag] = result.range_tag;
+        new_tags[list->tau_tag] = result.tau_tag;
+        const size_t num_list_variables = list->target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        for (size_t i = 0; i < num_list_variables; ++i) {
+            result.variable_indices.emplace_back(to_builder_index(list->variable_indices[i]));
+        }
+        range_lists.insert({ result.target_range, result });
+    }
+
+    // Copy cycles and tags of the new variables, and of the base and shared variables the sub-builder changed
+    const auto copy_variable = [&](const uint32_t sub_index) {
+        const uint32_t index = to_builder_index(sub_index);
+        const uint32_t next = sub.next_var_index[sub_index];
+        const uint32_t prev = sub.prev_var_index[sub_index];
+        this->next_var_index[index] = next == this->REAL_VARIABLE ? next : to_builder_index(next);
+        this->prev_var_index[index] = prev == this->FIRST_VARIABLE_IN_CLASS ? prev : to_builder_index(prev);
+        this->real_variable_index[index] = to_builder_index(sub.real_variable_index[sub_index]);
+        this->real_variable_tags[index] = to_builder_tag(sub.real_variable_tags[sub_index]);
+    };
+    for (const uint32_t index : changed_variables) {
+        copy_variable(index);
+    }
+    for (size_t i = 0; i < num_new_variables; ++i) {
+        if (!dropped_variables[i] && !shared_constant_flags[i]) {
+            copy_variable(static_cast<uint32_t>(num_base_variables + i));
+        }
+    }
+    for (const uint32_t index : shared_constants) {
+        if (!matches_base(sub, index, true)) {
+            copy_variable(index);
+        }
+    }
+    for (const auto& [value, index] : new_constants) {
+        constant_variable_indices.insert({ value, to_builder_index(index) });
+    }
+    for (const auto& [index, name] : sub.variable_names) {
+        if (index >= num_base_variables) {
+            this->variable_names[to_builder_index(index)] = name;
+        }
+    }
+
+    // Lookup tables are numbered in the order they are first used
+    std::vector<uint32_t> table_indices(sub.lookup_tables.size());
+    for (size_t i = 0; i < sub.lookup_tables.size(); ++i) {
+        const auto& sub_table = sub.lookup_tables[i];
+        auto& table = get_table(sub_table.id);
+        table_indices[i] = static_cast<uint32_t>(table.table_index);
+        const size_t start = i < base.lookup_tables.size() ? base.lookup_tables[i].lookup_gates.size() : 0;
+        table.lookup_gates.insert(table.lookup_gates.end(),
+                                  sub_table.lookup_gates.begin() + static_cast<std::ptrdiff_t>(start),
+                                  sub_table.lookup_gates.end());
+    }
+
+    auto& selector_columns = selectors.get();
+    const auto& sub_selector_columns = sub.selectors.get();
+    for (size_t i = 0; i < num_sub_gates; ++i) {
+        if (dropped_gates[i]) {
+            continue;
+        }
+        for (size_t j = 0; j < NUM_WIRES; ++j) {
+            wires[j].emplace_back(to_builder_index(sub.wires[j][i]));
+        }
+        for (size_t j = 0; j < selector_columns.size(); ++j) {
+            selector_columns[j].emplace_back(sub_selector_columns[j][i]);
+        }
+        if (sub.q_lookup_type()[i] != 0) {
+            q_3().back() = FF(table_indices[static_cast<size_t>(uint256_t(sub.q_3()[i]).data[0])]);
+        }
+        check_selector_length_consistency();
+        ++this->num_gates;
+    }
+
+    for (const auto& [target_range, sub_index] : range_constrained_variables) {
+        range_lists[target_range].variable_indices.emplace_back(to_builder_index(sub_index));
+    }
+    for (size_t i = num_base_multiplications; i < sub.cached_partial_non_native_field_multiplications.size(); ++i) {
+        auto multiplication = sub.cached_partial_non_native_field_multiplications[i];
+        for (size_t j = 0; j < 5; ++j) {
+            multiplication.a[j] = to_builder_index(multiplication.a[j]);
+            multiplication.b[j] = to_builder_index(multiplication.b[j]);
+        }
+        cached_partial_non_native_field_multiplications.emplace_back(multiplication);
+    }
+    if (sub.failed() && !base.failed() && !this->failed()) {
+        this->failure(sub.err());
+    }
+    return true;
+}
+
 /**
  * @brief Create an addition gate, where in.a * in.a_scaling + in.b * in.b_scaling + in.c * in.c_scaling +
  * in.const_scaling = 0
@@ -3226,7 +3581,35 @@ inline typename Arithmetization::FF UltraCircuitBuilder_<Arithmetization>::compu
  */
 template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::check_circuit()
 {
-    bool result = true;
+    const auto check = check_circuit_detailed(/*max_failing_gates=*/1);
+#ifndef FUZZING
+    for (const auto& failing_gate : check.failing_gates) {
+        info(failing_gate.relation, " fails at gate ", failing_gate.gate_index);
+    }
+    if (check.failing_gates.empty() && !check.tag_permutation_holds) {
+        info("Tag permutation failed");
+    }
+#endif
+    return check.passed();
+}
+
+/**
+ * @brief Check the circuit like check_circuit, reporting up to max_failing_gates failures
+ *
+ * @details The finalized circuit is split into contiguous blocks of gates which are checked in parallel. Evaluating a
+ * gate only reads the finalized builder, so the threads share it. Each block records its own first failures (at most
+ * one per gate, for the first relation that does not vanish, in the order arithmetic, auxiliary, elliptic, genperm
+ * sort, lookup). The blocks are then merged in gate order. Each thread also records the first tagged occurrence of
+ * every variable in its block for the tag permutation check. Merging these in block order gives exactly the variable
+ * values a serial pass would use.
+ *
+ * @param max_failing_gates Maximum number of failing gates to report; these are the ones with the lowest indices
+ */
+template <typename Arithmetization>
+typename UltraCircuitBuilder_<Arithmetization>::CircuitCheckResult UltraCircuitBuilder_<Arithmetization>::
+    check_circuit_detailed(const size_t max_failing_gates)
+{
+    CircuitCheckResult result;
     CircuitDataBackup circuit_backup = CircuitDataBackup::store_prefinilized_state(this);
     // Finalize circuit-in-the-head
 
@@ -3240,14 +3623,14 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
     const FF alpha = FF::random_element();
     const FF eta = FF::random_element();
 
-    // We need to get all memory
-    std::unordered_set<size_t> memory_read_record_gates;
-    std::unordered_set<size_t> memory_write_record_gates;
+    // Mark the memory record gates (one extra entry so that the shifted lookup at the last gate is in range)
+    enum MemoryRecordType : uint8_t { NONE, READ, WRITE };
+    std::vector<MemoryRecordType> memory_record_types(this->num_gates + 1, NONE);
     for (const auto& gate_idx : memory_read_records) {
-        memory_read_record_gates.insert(gate_idx);
+        memory_record_types[gate_idx] = READ;
     }
     for (const auto& gate_idx : memory_write_records) {
-        memory_write_record_gates.insert(gate_idx);
+        memory_record_types[gate_idx] = WRITE;
     }
 
     // A hashing implementation for quick simulation lookups
@@ -3285,101 +3668,47 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
-    // We use a running tag product mechanism to ensure tag correctness
-    // This is the product of (value + γ ⋅ tag)
-    FF left_tag_product = FF::one();
-    // This is the product of (value + γ ⋅ tau[tag])
-    FF right_tag_product = FF::one();
-    // Randomness for the tag check
-    const FF tag_gamma = FF::random_element();
-    // We need to include each variable only once
-    std::unordered_set<size_t> encountered_variables;
-
-    // Function to quickly update tag products and encountered variable set by index and value
-    auto update_tag_check_information = [&](size_t variable_index, FF value) {
-        size_t real_index = this->real_variable_index[variable_index];
-        // Check to ensure that we are not including a variable twice
-        if (encountered_variables.contains(real_index)) {
-            return;
-        }
-        size_t tag_in = this->real_variable_tags[real_index];
-        if (tag_in != DUMMY_TAG) {
-            size_t tag_out = this->tau.at((uint32_t)tag_in);
-            left_tag_product *= value + tag_gamma * FF(tag_in);
-            right_tag_product *= value + tag_gamma * FF(tag_out);
-            encountered_variables.insert(real_index);
+    // The value of the 4th wire at a gate, which for memory records is computed from the other wires
+    const auto get_w_4_value = [&](const size_t gate_idx, const FF& w_1, const FF& w_2, const FF& w_3) {
+        switch (memory_record_types[gate_idx]) {
+        case READ:
+            return ((w_3 * eta + w_2) * eta + w_1) * eta;
+        case WRITE:
+            return ((w_3 * eta + w_2) * eta + w_1) * eta + FF::one();
+        default:
+            return this->get_variable(w_4()[gate_idx]);
         }
     };
-    // For each gate
-    for (size_t i = 0; i < this->num_gates; i++) {
-        FF q_arith_value;
-        FF q_aux_value;
-        FF q_elliptic_value;
-        FF q_sort_value;
-        FF q_lookup_type_value;
-        FF q_1_value;
-        FF q_2_value;
-        FF q_3_value;
-        FF q_4_value;
-        FF q_m_value;
-        FF q_c_value;
-        FF w_1_value;
-        FF w_2_value;
-        FF w_3_value;
-        FF w_4_value;
-        FF w_4_index;
-        // Get the values of selectors and wires and update tag products along the way
-        q_arith_value = q_arith()[i];
-        q_aux_value = q_aux()[i];
-        q_elliptic_value = q_elliptic()[i];
-        q_sort_value = q_sort()[i];
-        q_lookup_type_value = q_lookup_type()[i];
-        q_1_value = q_1()[i];
-        q_2_value = q_2()[i];
-        q_3_value = q_3()[i];
-        q_4_value = q_4()[i];
-        q_m_value = q_m()[i];
-        q_c_value = q_c()[i];
-        w_1_value = this->get_variable(w_l()[i]);
-        update_tag_check_information(w_l()[i], w_1_value);
-        w_2_value = this->get_variable(w_r()[i]);
-        update_tag_check_information(w_r()[i], w_2_value);
-        w_3_value = this->get_variable(w_o()[i]);
-        update_tag_check_information(w_o()[i], w_3_value);
-        w_4_value = this->get_variable(w_4()[i]);
-        // We need to wait before updating tag product for w_4
-        w_4_index = w_4()[i];
-
-        // If we are touching a gate with memory access, we need to update the value of the 4th witness
-        if (memory_read_record_gates.contains(i)) {
-            w_4_value = ((w_3_value * eta + w_2_value) * eta + w_1_value) * eta;
-        }
-        if (memory_write_record_gates.contains(i)) {
-            w_4_value = ((w_3_value * eta + w_2_value) * eta + w_1_value) * eta + FF::one();
-        }
-        // Now we can update the tag product for w_4
-        update_tag_check_information((uint32_t)w_4_index, w_4_value);
-        FF w_1_shifted_value;
-        FF w_2_shifted_value;
-        FF w_3_shifted_value;
-        FF w_4_shifted_value;
+
+    // Returns the name of the first relation that does not vanish at the gate, or nullptr if the gate is satisfied
+    const auto check_gate = [&](const size_t i,
+                                const FF& w_1_value,
+                                const FF& w_2_value,
+                                const FF& w_3_value,
+                                const FF& w_4_value) -> const char* {
+        const FF q_arith_value = q_arith()[i];
+        const FF q_aux_value = q_aux()[i];
+        const FF q_elliptic_value = q_elliptic()[i];
+        const FF q_sort_value = q_sort()[i];
+        const FF q_lookup_type_value = q_lookup_type()[i];
+        const FF q_1_value = q_1()[i];
+        const FF q_2_value = q_2()[i];
+        const FF q_3_value = q_3()[i];
+        const FF q_4_value = q_4()[i];
+        const FF q_m_value = q_m()[i];
+        const FF q_c_value = q_c()[i];
+        FF w_1_shifted_value = FF::zero();
+        FF w_2_shifted_value = FF::zero();
+        FF w_3_shifted_value = FF::zero();
+        FF w_4_shifted_value = FF::zero();
         if (i < (this->num_gates - 1)) {
             w_1_shifted_value = this->get_variable(w_l()[i + 1]);
             w_2_shifted_value = this->get_variable(w_r()[i + 1]);
             w_3_shifted_value = this->get_variable(w_o()[i + 1]);
             w_4_shifted_value = this->get_variable(w_4()[i + 1]);
-        } else {
-            w_1_shifted_value = FF::zero();
-            w_2_shifted_value = FF::zero();
-            w_3_shifted_value = FF::zero();
-            w_4_shifted_value = FF::zero();
-        }
-        if (memory_read_record_gates.contains(i + 1)) {
-            w_4_shifted_value = ((w_3_shifted_value * eta + w_2_shifted_value) * eta + w_1_shifted_value) * eta;
         }
-        if (memory_write_record_gates.contains(i + 1)) {
-            w_4_shifted_value =
-                ((w_3_shifted_value * eta + w_2_shifted_value) * eta + w_1_shifted_value) * eta + FF::one();
+        if (memory_record_types[i + 1] != NONE) {
+            w_4_shifted_value = get_w_4_value(i + 1, w_1_shifted_value, w_2_shifted_value, w_3_shifted_value);
         }
         if (!compute_arithmetic_identity(q_arith_value,
                                          q_1_value,
@@ -3397,11 +3726,7 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
                                          arithmetic_base,
                                          alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Arithmetic identity fails at gate ", i);
-#endif
-            result = false;
-            break;
+            return "Arithmetic identity";
         }
         if (!compute_auxilary_identity(q_aux_value,
                                        q_arith_value,
@@ -3423,12 +3748,7 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
                                        alpha,
                                        eta)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Auxilary identity fails at gate ", i);
-#endif
-
-            result = false;
-            break;
+            return "Auxilary identity";
         }
         if (!compute_elliptic_identity(q_elliptic_value,
                                        q_1_value,
@@ -3442,45 +3762,87 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
                                        elliptic_base,
                                        alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Elliptic identity fails at gate ", i);
-#endif
-            result = false;
-            break;
+            return "Elliptic identity";
         }
         if (!compute_genperm_sort_identity(
                  q_sort_value, w_1_value, w_2_value, w_3_value, w_4_value, w_1_shifted_value, genperm_sort_base, alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Genperm sort identity fails at gate ", i);
-#endif
-
-            result = false;
-            break;
+            return "Genperm sort identity";
         }
         if (!q_lookup_type_value.is_zero()) {
             if (!table_hash.contains(std::make_tuple(w_1_value + q_2_value * w_1_shifted_value,
                                                      w_2_value + q_m_value * w_2_shifted_value,
                                                      w_3_value + q_c_value * w_3_shifted_value,
                                                      q_3_value))) {
-#ifndef FUZZING
-                info("Lookup fails at gate ", i);
-#endif
-
-                result = false;
-                break;
+                return "Lookup";
             }
         }
-    }
-    if (left_tag_product != right_tag_product) {
-#ifndef FUZZING
-        if (result) {
-            info("Tag permutation failed");
+        return nullptr;
+    };
+
+    struct BlockResult {
+        std::vector<FailingGate> failing_gates;
+        // The value of the first occurrence in the block of each variable with a tag, indexed by real variable index
+        std::unordered_map<uint32_t, FF> tagged_values;
+    };
+    constexpr size_t MIN_GATES_PER_BLOCK = 1 << 10;
+    const size_t num_blocks = thread_utils::calculate_num_threads(this->num_gates, MIN_GATES_PER_BLOCK);
+    const size_t block_size = (this->num_gates + num_blocks - 1) / num_blocks;
+    std::vector<BlockResult> block_results(num_blocks);
+    parallel_for(num_blocks, [&](size_t block_idx) {
+        auto& block_result = block_results[block_idx];
+        const auto record_tagged_value = [&](const uint32_t variable_index, const FF& value) {
+            const uint32_t real_index = this->real_variable_index[variable_index];
+            if (this->real_variable_tags[real_index] != DUMMY_TAG) {
+                block_result.tagged_values.try_emplace(real_index, value);
+            }
+        };
+        const size_t end = std::min(this->num_gates, (block_idx + 1) * block_size);
+        for (size_t i = block_idx * block_size; i < end; i++) {
+            const FF w_1_value = this->get_variable(w_l()[i]);
+            const FF w_2_value = this->get_variable(w_r()[i]);
+            const FF w_3_value = this->get_variable(w_o()[i]);
+            const FF w_4_value = get_w_4_value(i, w_1_value, w_2_value, w_3_value);
+            record_tagged_value(w_l()[i], w_1_value);
+            record_tagged_value(w_r()[i], w_2_value);
+            record_tagged_value(w_o()[i], w_3_value);
+            record_tagged_value(w_4()[i], w_4_value);
+
+            if (block_result.failing_gates.size() < max_failing_gates) {
+                if (const char* relation = check_gate(i, w_1_value, w_2_value, w_3_value, w_4_value)) {
+                    block_result.failing_gates.push_back({ i, relation });
+                }
+            }
         }
-#endif
+    });
 
-        result = false;
+    // We use a running tag product mechanism to ensure tag correctness
+    // This is the product of (value + γ ⋅ tag)
+    FF left_tag_product = FF::one();
+    // This is the product of (value + γ ⋅ tau[tag])
+    FF right_tag_product = FF::one();
+    // Randomness for the tag check
+    const FF tag_gamma = FF::random_element();
+    // We need to include each variable only once, with the value at its first occurrence
+    std::unordered_set<uint32_t> encountered_variables;
+    for (auto& block_result : block_results) {
+        for (const auto& failing_gate : block_result.failing_gates) {
+            if (result.failing_gates.size() < max_failing_gates) {
+                result.failing_gates.push_back(failing_gate);
+            }
+        }
+        for (const auto& [real_index, value] : block_result.tagged_values) {
+            if (!encountered_variables.insert(real_index).second) {
+                continue;
+            }
+            const uint32_t tag_in = this->real_variable_tags[real_index];
+            const uint32_t tag_out = this->tau.at(tag_in);
+            left_tag_product *= value + tag_gamma * FF(tag_in);
+            right_tag_product *= value + tag_gamma * FF(tag_out);
+        }
     }
+    result.tag_permutation_holds = left_tag_product == right_tag_product;
+
     circuit_backup.restore_prefinilized_state(this);
     return result;
 }
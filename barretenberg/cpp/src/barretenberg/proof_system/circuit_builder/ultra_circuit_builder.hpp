@@ -283,14 +283,14 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         using SelectorVector = std::vector<FF, bb::ContainerSlabAllocator<FF>>;
 
         std::vector<uint32_t> public_inputs;
-        std::vector<FF> variables;
+        SelectorVector variables;
         // index of next variable in equivalence class (=REAL_VARIABLE if you're last)
-        std::vector<uint32_t> next_var_index;
+        WireVector next_var_index;
         // index of  previous variable in equivalence class (=FIRST if you're in a cycle alone)
-        std::vector<uint32_t> prev_var_index;
+        WireVector prev_var_index;
         // indices of corresponding real variables
-        std::vector<uint32_t> real_variable_index;
-        std::vector<uint32_t> real_variable_tags;
+        WireVector real_variable_index;
+        WireVector real_variable_tags;
         std::map<FF, uint32_t> constant_variable_indices;
         WireVector w_l;
         WireVector w_r;
@@ -645,14 +645,30 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     bool circuit_finalized = false;
 
     void process_non_native_field_multiplications();
-    UltraCircuitBuilder_(const size_t size_hint = 0)
-        : CircuitBuilderBase<FF>(size_hint)
+
+  private:
+    void init_trace(const size_t num_gates, Arena* arena)
+    {
+        for (auto& wire : wires) {
+            wire = WireVector(ContainerSlabAllocator<uint32_t>(arena));
+            wire.reserve(num_gates);
+        }
+        for (auto& selector : selectors.get()) {
+            selector = SelectorVector(ContainerSlabAllocator<FF>(arena));
+            selector.reserve(num_gates);
+        }
+    }
+
+  public:
+    /**
+     * @param size_hint the expected number of gates
+     * @param profile the sizes of a previous build of the circuit, which take precedence over size_hint if given
+     * @param arena an arena to allocate the variables, wires and selectors from, which must outlive the builder
+     */
+    UltraCircuitBuilder_(const size_t size_hint = 0, const CircuitSizeProfile& profile = {}, Arena* arena = nullptr)
+        : CircuitBuilderBase<FF>(size_hint, profile, arena)
     {
-        selectors.reserve(size_hint);
-        w_l().reserve(size_hint);
-        w_r().reserve(size_hint);
-        w_o().reserve(size_hint);
-        w_4().reserve(size_hint);
+        init_trace(profile.num_gates > 0 ? profile.num_gates : size_hint, arena);
         this->zero_idx = put_constant_variable(FF::zero());
         this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
     };
@@ -663,6 +679,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
      * @param witness_values witnesses values known to acir
      * @param public_inputs indices of public inputs in witness array
      * @param varnum number of known witness
+     * @param profile the sizes of a previous build of the circuit, which take precedence over size_hint if given
+     * @param arena an arena to allocate the variables, wires and selectors from, which must outlive the builder
      *
      * @note The size of witness_values may be less than varnum. The former is the set of actual witness values known at
      * the time of acir generation. The former may be larger and essentially acounts for placeholders for witnesses that
@@ -673,14 +691,12 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     UltraCircuitBuilder_(const size_t size_hint,
                          auto& witness_values,
                          const std::vector<uint32_t>& public_inputs,
-                         size_t varnum)
-        : CircuitBuilderBase<FF>(size_hint)
+                         size_t varnum,
+                         const CircuitSizeProfile& profile = {},
+                         Arena* arena = nullptr)
+        : CircuitBuilderBase<FF>(size_hint, profile, arena)
     {
-        selectors.reserve(size_hint);
-        w_l().reserve(size_hint);
-        w_r().reserve(size_hint);
-        w_o().reserve(size_hint);
-        w_4().reserve(size_hint);
+        init_trace(profile.num_gates > 0 ? profile.num_gates : size_hint, arena);
 
         for (size_t idx = 0; idx < varnum; ++idx) {
             // Zeros are added for variables whose existence is known but whose values are not yet known. The values may
@@ -701,41 +717,49 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     UltraCircuitBuilder_(UltraCircuitBuilder_&& other)
         : CircuitBuilderBase<FF>(std::move(other))
     {
-        wires = other.wires;
-        selectors = other.selectors;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        lookup_multi_tables = other.lookup_multi_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        wires = std::move(other.wires);
+        selectors = std::move(other.selectors);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        lookup_multi_tables = std::move(other.lookup_multi_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = default;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
     {
         CircuitBuilderBase<FF>::operator=(std::move(other));
-        wires = other.wires;
-        selectors = other.selectors;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        lookup_multi_tables = other.lookup_multi_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        wires = std::move(other.wires);
+        selectors = std::move(other.selectors);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        lookup_multi_tables = std::move(other.lookup_multi_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
         return *this;
     };
     ~UltraCircuitBuilder_() override = default;
 
+    /**
+     * @brief The number of gates and variables of the circuit so far, to build it again without growing any of them
+     * @details Record it from the finalized circuit, as finalization adds both gates and variables.
+     */
+    CircuitSizeProfile get_size_profile() const { return { w_l().size(), this->variables.size() }; }
+
     /**
      * @brief Debug helper method for ensuring all selectors have the same size
      * @details Each gate construction method manually appends values to the selectors. Failing to update one of the
@@ -759,6 +783,9 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
 
     void add_gates_to_ensure_all_polys_are_non_zero();
 
+    UltraCircuitBuilder_ create_sub_builder() const;
+    bool splice_sub_builder(const UltraCircuitBuilder_& sub_builder, const UltraCircuitBuilder_& base);
+
     void create_add_gate(const add_triple_<FF>& in) override;
 
     void create_big_add_gate(const add_quad_<FF>& in, const bool use_next_gate_w_4 = false);
@@ -1166,7 +1193,25 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
                                      FF alpha_base,
                                      FF alpha) const;
 
+    /**
+     * @brief A gate at which a relation of the finalized circuit does not vanish
+     */
+    struct FailingGate {
+        size_t gate_index;
+        // The relation that fails, e.g. "Arithmetic identity" or "Lookup"
+        std::string relation;
+    };
+
+    struct CircuitCheckResult {
+        // The failing gates with the lowest indices, in increasing order
+        std::vector<FailingGate> failing_gates;
+        bool tag_permutation_holds = true;
+
+        bool passed() const { return failing_gates.empty() && tag_permutation_holds; }
+    };
+
     bool check_circuit();
+    CircuitCheckResult check_circuit_detailed(size_t max_failing_gates);
 };
 using UltraCircuitBuilder = UltraCircuitBuilder_<arithmetization::Ultra<bb::fr>>;
 } // namespace bb
@@ -849,4 +849,49 @@ TEST(ultra_circuit_constructor, check_circuit_showcase)
     EXPECT_EQ(circuit_constructor.check_circuit(), true);
 }
 
+TEST(ultra_circuit_constructor, arena_with_size_profile)
+{
+    const auto build = [](UltraCircuitBuilder& circuit_constructor) {
+        auto idx = add_variables(circuit_constructor, { 1, 2, 3, 4, 5, 6, 7, 8 });
+        for (size_t i = 0; i < idx.size(); i++) {
+            circuit_constructor.create_new_range_constraint(idx[i], 8);
+        }
+        for (size_t i = 0; i < 64; i++) {
+            const uint32_t sum_idx = circuit_constructor.add_variable(fr(i + 3));
+            circuit_constructor.create_add_gate(
+                { idx[0], idx[1], sum_idx, fr::one(), fr::one(), fr::neg_one(), fr(i) });
+        }
+        circuit_constructor.finalize_circuit();
+    };
+    UltraCircuitBuilder expected;
+    build(expected);
+
+    Arena arena(Arena::HUGE_PAGE_SIZE);
+    CircuitSizeProfile profile;
+    {
+        UltraCircuitBuilder circuit_constructor(0, {}, &arena);
+        build(circuit_constructor);
+        profile = circuit_constructor.get_size_profile();
+    }
+    arena.reset();
+    const size_t num_chunks = arena.get_num_chunks();
+
+    // Built again with its profile, the circuit fills the vectors it reserved without reallocating any of them
+    UltraCircuitBuilder circuit_constructor(0, profile, &arena);
+    const auto* wires = circuit_constructor.w_l().data();
+    const auto* selectors = circuit_constructor.q_arith().data();
+    const auto* variables = circuit_constructor.variables.data();
+    build(circuit_constructor);
+    EXPECT_EQ(circuit_constructor.w_l().data(), wires);
+    EXPECT_EQ(circuit_constructor.q_arith().data(), selectors);
+    EXPECT_EQ(circuit_constructor.variables.data(), variables);
+    EXPECT_EQ(arena.get_num_chunks(), num_chunks);
+    EXPECT_TRUE(UltraCircuitBuilder::CircuitDataBackup::store_full_state(expected).is_same_state(circuit_constructor));
+
+    // Copies do not depend on the arena
+    UltraCircuitBuilder copy = circuit_constructor;
+    EXPECT_EQ(copy.w_l().get_allocator().get_arena(), nullptr);
+    EXPECT_TRUE(UltraCircuitBuilder::CircuitDataBackup::store_full_state(expected).is_same_state(copy));
+}
+
 } // namespace bb
\ No newline at end of file
@@ -425,6 +425,7 @@ void compute_plonk_permutation_lagrange_polynomials_from_mapping(
 template <size_t program_width>
 void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label, plonk::proving_key* key)
 {
+    std::array<bb::polynomial, program_width> sigma_ffts;
     for (size_t i = 0; i < program_width; ++i) {
         std::string index = std::to_string(i + 1);
         std::string prefix = label + "_" + index;
@@ -436,12 +437,20 @@ void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label,
         bb::polynomial_arithmetic::ifft(
             (bb::fr*)&sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
 
-        // Compute permutation polynomial coset FFT form
-        bb::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
+        sigma_ffts[i] = bb::polynomial(sigma_polynomial, key->large_domain.size);
 
         key->polynomial_store.put(prefix, sigma_polynomial.share());
-        key->polynomial_store.put(prefix + "_fft", sigma_fft.share());
+    }
+
+    // Compute the permutation polynomial coset FFT forms in one batch
+    std::vector<bb::fr*> sigma_fft_ptrs;
+    for (auto& sigma_fft : sigma_ffts) {
+        sigma_fft_ptrs.push_back(sigma_fft.data().get());
+    }
+    bb::polynomial_arithmetic::coset_fft_batch(sigma_fft_ptrs, key->large_domain);
+
+    for (size_t i = 0; i < program_width; ++i) {
+        key->polynomial_store.put(label + "_" + std::to_string(i + 1) + "_fft", sigma_ffts[i].share());
     }
 }
 
@@ -110,7 +110,6 @@ void compute_grand_product(const size_t circuit_size,
 
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
         if (thread_idx > 0) {
             FF numerator_scaling = 1;
             FF denominator_scaling = 1;
@@ -119,25 +118,24 @@ void compute_grand_product(const size_t circuit_size,
                 numerator_scaling *= partial_numerators[j];
                 denominator_scaling *= partial_denominators[j];
             }
-            for (size_t i = start; i < end; ++i) {
-                numerator[i] *= numerator_scaling;
-                denominator[i] *= denominator_scaling;
-            }
+            FF::batch_mul(std::span{ &numerator[start], block_size }, numerator_scaling);
+            FF::batch_mul(std::span{ &denominator[start], block_size }, denominator_scaling);
         }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator[start], block_size });
     });
 
+    // Final step: invert denominator
+    FF::parallel_batch_invert(denominator);
+
     // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
     auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
     grand_product_polynomial[0] = 0;
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
         const size_t end = (thread_idx == num_threads - 1) ? circuit_size - 1 : (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end; ++i) {
-            grand_product_polynomial[i + 1] = numerator[i] * denominator[i];
-        }
+        const size_t range = end - start;
+        // numerator is no longer needed; compute the quotients in place and copy them into the shifted position
+        FF::batch_mul(std::span{ &numerator[start], range }, std::span<const FF>{ &denominator[start], range });
+        std::copy(&numerator[start], &numerator[start] + range, &grand_product_polynomial[start + 1]);
     });
 }
 
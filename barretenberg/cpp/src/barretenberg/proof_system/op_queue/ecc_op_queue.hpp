@@ -2,6 +2,7 @@
 
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/proof_system/circuit_builder/eccvm/eccvm_builder_types.hpp"
+#include <memory>
 
 namespace bb {
 
@@ -90,6 +91,27 @@ class ECCOpQueue {
         return result;
     }
 
+    /**
+     * @brief Get a copy of the current aggregate transcript T_i together with the size data
+     * @details Used to run a merge prover while later circuits continue to append to this queue. Only the first M_i
+     * ultra ops rows are copied; the raw ops and the native accumulator are not needed by the merge prover. The
+     * commitments are left for the caller to set, since they may still be in the process of being computed.
+     *
+     * @return std::shared_ptr<ECCOpQueue>
+     */
+    std::shared_ptr<ECCOpQueue> get_ultra_ops_snapshot() const
+    {
+        auto snapshot = std::make_shared<ECCOpQueue>();
+        for (size_t idx = 0; idx < ultra_ops.size(); ++idx) {
+            const auto& column = ultra_ops[idx];
+            snapshot->ultra_ops[idx].assign(column.begin(),
+                                            column.begin() + static_cast<std::ptrdiff_t>(current_ultra_ops_size));
+        }
+        snapshot->current_ultra_ops_size = current_ultra_ops_size;
+        snapshot->previous_ultra_ops_size = previous_ultra_ops_size;
+        return snapshot;
+    }
+
     /**
      * @brief TESTING PURPOSES ONLY: Populate ECC op queue with mock data as stand in for "previous circuit" in tests
      * @details TODO(#723): We currently cannot support Goblin proofs (specifically, transcript aggregation) if there
@@ -6,17 +6,26 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "crs_factory.hpp"
 #include <cstddef>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
 #include <utility>
 
 namespace bb::srs::factories {
 
 /**
- * Create reference strings given a path to a directory of transcript files.
+ * Create reference strings given a path to a directory of transcript files. Safe to share between threads, e.g. the
+ * background prover of Goblin::accumulate_async and the thread building the next circuit.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
     FileCrsFactory(std::string path, size_t initial_degree = 0);
-    FileCrsFactory(FileCrsFactory&& other) = default;
+    FileCrsFactory(FileCrsFactory&& other) noexcept
+        : path_(std::move(other.path_))
+        , degree_(other.degree_)
+        , prover_crs_(std::move(other.prover_crs_))
+        , verifier_crs_(std::move(other.verifier_crs_))
+    {}
 
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
 
@@ -27,6 +36,9 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
     size_t degree_;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> verifier_crs_;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex_;
+#endif
 };
 
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
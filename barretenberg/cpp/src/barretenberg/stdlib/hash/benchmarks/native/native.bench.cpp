@@ -0,0 +1,99 @@
+/**
+ * @file native.bench.cpp
+ * @brief Throughput of the native hashes on many independent messages, one at a time against the multi-message
+ * engines
+ *
+ */
+#include "barretenberg/crypto/blake2s/blake2s.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+constexpr size_t NUM_MESSAGES = 4096;
+
+std::vector<std::vector<uint8_t>> generate_messages(size_t message_size)
+{
+    std::vector<std::vector<uint8_t>> messages(NUM_MESSAGES, std::vector<uint8_t>(message_size));
+    for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+        for (size_t j = 0; j < message_size; ++j) {
+            messages[i][j] = static_cast<uint8_t>(i * 31 + j);
+        }
+    }
+    return messages;
+}
+
+void set_throughput(State& state)
+{
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_MESSAGES));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(NUM_MESSAGES) * state.range(0));
+}
+
+void sha256_single_bench(State& state) noexcept
+{
+    const auto messages = generate_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(sha256::sha256(message));
+        }
+    }
+    set_throughput(state);
+}
+BENCHMARK(sha256_single_bench)->Arg(32)->Arg(64)->Arg(136)->Arg(1024)->Unit(kMillisecond);
+
+void sha256_many_bench(State& state) noexcept
+{
+    const auto messages = generate_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(sha256::sha256_many(messages));
+    }
+    set_throughput(state);
+}
+BENCHMARK(sha256_many_bench)->Arg(32)->Arg(64)->Arg(136)->Arg(1024)->Unit(kMillisecond);
+
+void keccak256_single_bench(State& state) noexcept
+{
+    const auto messages = generate_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(ethash_keccak256(message.data(), message.size()));
+        }
+    }
+    set_throughput(state);
+}
+BENCHMARK(keccak256_single_bench)->Arg(32)->Arg(64)->Arg(136)->Arg(1024)->Unit(kMillisecond);
+
+void keccak256_many_bench(State& state) noexcept
+{
+    const auto messages = generate_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(keccak256_many(messages));
+    }
+    set_throughput(state);
+}
+BENCHMARK(keccak256_many_bench)->Arg(32)->Arg(64)->Arg(136)->Arg(1024)->Unit(kMillisecond);
+
+void blake2s_single_bench(State& state) noexcept
+{
+    const auto messages = generate_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(bb::crypto::blake2s(message));
+        }
+    }
+    set_throughput(state);
+}
+BENCHMARK(blake2s_single_bench)->Arg(32)->Arg(64)->Arg(136)->Arg(1024)->Unit(kMillisecond);
+
+void blake2s_many_bench(State& state) noexcept
+{
+    const auto messages = generate_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(bb::crypto::blake2s_many(messages));
+    }
+    set_throughput(state);
+}
+BENCHMARK(blake2s_many_bench)->Arg(32)->Arg(64)->Arg(136)->Arg(1024)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
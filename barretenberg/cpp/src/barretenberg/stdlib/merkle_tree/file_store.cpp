@@ -0,0 +1,256 @@
+#include "file_store.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <array>
+#include <filesystem>
+
+namespace bb::stdlib::merkle_tree {
+
+namespace {
+
+/**
+ * The log is a sequence of batches, one per commit, each laid out as
+ *
+ *   magic (4 bytes) | number of records (4 bytes) | payload size (8 bytes) | payload | checksum (8 bytes)
+ *
+ * where the payload is the batch's records, each either
+ *
+ *   PUT_RECORD | key size (4 bytes) | key | value size (4 bytes) | value
+ *   DELETE_RECORD | key size (4 bytes) | key
+ *
+ * and the checksum covers the header and the payload.
+ */
+constexpr uint32_t BATCH_MAGIC = 0x424d5442; // "BMTB"
+constexpr size_t BATCH_HEADER_SIZE = 16;
+constexpr uint8_t PUT_RECORD = 0;
+constexpr uint8_t DELETE_RECORD = 1;
+
+// 64-bit FNV-1a, to tell a fully written batch from a torn one
+uint64_t fnv1a(uint8_t const* data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+void write_bytes(std::vector<uint8_t>& buf, std::string const& bytes)
+{
+    using serialize::write;
+    write(buf, static_cast<uint32_t>(bytes.size()));
+    buf.insert(buf.end(), bytes.begin(), bytes.end());
+}
+
+} // namespace
+
+FileStore::FileStore(std::string const& path)
+    : path_(path)
+    , read_only_(false)
+    , index_(std::make_shared<Index>())
+{
+    replay();
+    writer_.open(path_, std::ios::binary | std::ios::app);
+    reader_.open(path_, std::ios::binary);
+    if (!writer_ || !reader_) {
+        throw_or_abort("FileStore: could not open " + path_);
+    }
+}
+
+FileStore::FileStore(std::string path, std::shared_ptr<Index> index, uint64_t version)
+    : path_(std::move(path))
+    , read_only_(true)
+    , index_(std::move(index))
+    , version_(version)
+{
+    reader_.open(path_, std::ios::binary);
+    if (!reader_) {
+        throw_or_abort("FileStore: could not open " + path_);
+    }
+}
+
+bool FileStore::put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value)
+{
+    return put(to_string(key), value);
+}
+
+bool FileStore::put(std::string const& key, std::vector<uint8_t> const& value)
+{
+    if (read_only_) {
+        throw_or_abort("FileStore: cannot write to a snapshot");
+    }
+    puts_[key] = value;
+    deletes_.erase(key);
+    return true;
+}
+
+bool FileStore::del(std::vector<uint8_t> const& key)
+{
+    if (read_only_) {
+        throw_or_abort("FileStore: cannot write to a snapshot");
+    }
+    auto key_str = to_string(key);
+    puts_.erase(key_str);
+    deletes_.insert(key_str);
+    return true;
+}
+
+bool FileStore::get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value)
+{
+    return get(to_string(key), value);
+}
+
+bool FileStore::get(std::string const& key, std::vector<uint8_t>& value)
+{
+    if (deletes_.find(key) != deletes_.end()) {
+        return false;
+    }
+    auto put_it = puts_.find(key);
+    if (put_it != puts_.end()) {
+        value = put_it->second;
+        return true;
+    }
+    auto it = index_->find(key);
+    if (it == index_->end()) {
+        return false;
+    }
+    value.resize(it->second.size);
+    // Clear any end-of-file state left by a read before the last commit grew the log
+    reader_.clear();
+    reader_.seekg(static_cast<std::streamoff>(it->second.offset));
+    reader_.read(reinterpret_cast<char*>(value.data()), static_cast<std::streamsize>(value.size()));
+    if (!reader_) {
+        throw_or_abort("FileStore: could not read from " + path_);
+    }
+    return true;
+}
+
+void FileStore::commit()
+{
+    using serialize::write;
+    if (read_only_) {
+        throw_or_abort("FileStore: cannot commit to a snapshot");
+    }
+    if (puts_.empty() && deletes_.empty()) {
+        return;
+    }
+
+    // Serialise the batch, noting where each value will land in the log
+    const uint64_t payload_offset = log_size_ + BATCH_HEADER_SIZE;
+    std::vector<uint8_t> payload;
+    std::vector<std::pair<std::string const*, Location>> locations;
+    locations.reserve(puts_.size());
+    for (auto const& [key, value] : puts_) {
+        write(payload, PUT_RECORD);
+        write_bytes(payload, key);
+        write(payload, static_cast<uint32_t>(value.size()));
+        locations.emplace_back(&key, Location{ payload_offset + payload.size(), static_cast<uint32_t>(value.size()) });
+        payload.insert(payload.end(), value.begin(), value.end());
+    }
+    for (auto const& key : deletes_) {
+        write(payload, DELETE_RECORD);
+        write_bytes(payload, key);
+    }
+
+    std::vector<uint8_t> batch;
+    batch.reserve(BATCH_HEADER_SIZE + payload.size() + sizeof(uint64_t));
+    write(batch, BATCH_MAGIC);
+    write(batch, static_cast<uint32_t>(puts_.size() + deletes_.size()));
+    write(batch, static_cast<uint64_t>(payload.size()));
+    batch.insert(batch.end(), payload.begin(), payload.end());
+    write(batch, fnv1a(batch.data(), batch.size()));
+
+    writer_.write(reinterpret_cast<const char*>(batch.data()), static_cast<std::streamsize>(batch.size()));
+    writer_.flush();
+    if (!writer_) {
+        throw_or_abort("FileStore: could not write to " + path_);
+    }
+
+    // Snapshots sharing the index keep seeing it as it was
+    if (index_.use_count() > 1) {
+        index_ = std::make_shared<Index>(*index_);
+    }
+    for (auto const& [key, location] : locations) {
+        (*index_)[*key] = location;
+    }
+    for (auto const& key : deletes_) {
+        index_->erase(key);
+    }
+    log_size_ += batch.size();
+    ++version_;
+    puts_.clear();
+    deletes_.clear();
+}
+
+void FileStore::rollback()
+{
+    puts_.clear();
+    deletes_.clear();
+}
+
+FileStore FileStore::snapshot() const
+{
+    return FileStore(path_, index_, version_);
+}
+
+void FileStore::replay()
+{
+    using serialize::read;
+    std::ifstream file(path_, std::ios::binary);
+    const uint64_t file_size = file ? std::filesystem::file_size(path_) : 0;
+
+    std::vector<uint8_t> batch;
+    while (log_size_ + BATCH_HEADER_SIZE <= file_size) {
+        batch.resize(BATCH_HEADER_SIZE);
+        file.read(reinterpret_cast<char*>(batch.data()), BATCH_HEADER_SIZE);
+        const uint8_t* it = batch.data();
+        uint32_t magic = 0;
+        uint32_t num_records = 0;
+        uint64_t payload_size = 0;
+        read(it, magic);
+        read(it, num_records);
+        read(it, payload_size);
+        const uint64_t batch_size = BATCH_HEADER_SIZE + payload_size + sizeof(uint64_t);
+        if (!file || magic != BATCH_MAGIC || payload_size > file_size - log_size_ - BATCH_HEADER_SIZE ||
+            batch_size > file_size - log_size_) {
+            break;
+        }
+        batch.resize(batch_size);
+        file.read(reinterpret_cast<char*>(batch.data() + BATCH_HEADER_SIZE),
+                  static_cast<std::streamsize>(batch_size - BATCH_HEADER_SIZE));
+        uint64_t checksum = 0;
+        const uint8_t* checksum_it = batch.data() + batch_size - sizeof(uint64_t);
+        read(checksum_it, checksum);
+        if (!file || checksum != fnv1a(batch.data(), batch_size - sizeof(uint64_t))) {
+            break;
+        }
+
+        it = batch.data() + BATCH_HEADER_SIZE;
+        for (uint32_t i = 0; i < num_records; ++i) {
+            uint8_t type = 0;
+            uint32_t key_size = 0;
+            read(it, type);
+            read(it, key_size);
+            std::string key(reinterpret_cast<const char*>(it), key_size);
+            it += key_size;
+            if (type == PUT_RECORD) {
+                uint32_t value_size = 0;
+                read(it, value_size);
+                (*index_)[key] = Location{ log_size_ + static_cast<uint64_t>(it - batch.data()), value_size };
+                it += value_size;
+            } else {
+                index_->erase(key);
+            }
+        }
+        log_size_ += batch_size;
+        ++version_;
+    }
+    file.close();
+
+    // Drop whatever follows the last complete batch, i.e. a commit that was interrupted, so that new batches are
+    // appended right after it
+    if (log_size_ < file_size) {
+        std::filesystem::resize_file(path_, log_size_);
+    }
+}
+
+} // namespace bb::stdlib::merkle_tree
@@ -0,0 +1,95 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bb::stdlib::merkle_tree {
+
+/**
+ * A key-value store for MerkleTree and NullifierTree, with the same interface as MemoryStore, persisted to an
+ * append-only log file.
+ *
+ * Writes are staged in memory until commit(), which appends them to the end of the log as one batch, in a single
+ * sequential write. Opening an existing log replays its batches into an in-memory index of where each value lives in
+ * the file, so a tree is available again at once, without recomputing any of its hashes. A batch is only applied if it
+ * was written completely (the batch ends with a checksum of its contents), so a commit interrupted by a crash is
+ * discarded, and truncated from the log, on the next open.
+ *
+ * Values are never overwritten in the log, so the store as of a commit is fully described by its index. snapshot()
+ * returns a read-only store sharing the current index, which the writable store copies before its next commit modifies
+ * it. The snapshot keeps reading its version of the tree from the log, including nodes the tree has since removed,
+ * which makes it suitable for serving hash paths against historical roots.
+ */
+class FileStore {
+  public:
+    /**
+     * Opens the store logged at `path`, creating the log file if it does not exist.
+     */
+    explicit FileStore(std::string const& path);
+
+    FileStore(FileStore const& rhs) = delete;
+    FileStore(FileStore&& rhs) = default;
+    FileStore& operator=(FileStore const& rhs) = delete;
+    FileStore& operator=(FileStore&& rhs) = default;
+    ~FileStore() = default;
+
+    bool put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value);
+
+    bool put(std::string const& key, std::vector<uint8_t> const& value);
+
+    bool del(std::vector<uint8_t> const& key);
+
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value);
+
+    bool get(std::string const& key, std::vector<uint8_t>& value);
+
+    /**
+     * Appends the staged writes to the log and applies them to the index.
+     */
+    void commit();
+
+    void rollback();
+
+    /**
+     * Returns a read-only view of the store as of the last commit.
+     */
+    FileStore snapshot() const;
+
+    /**
+     * The number of commits in the log; a snapshot keeps the number of the commit it was taken at.
+     */
+    uint64_t version() const { return version_; }
+
+  private:
+    // Where a value lives in the log
+    struct Location {
+        uint64_t offset;
+        uint32_t size;
+    };
+    using Index = std::unordered_map<std::string, Location>;
+
+    FileStore(std::string path, std::shared_ptr<Index> index, uint64_t version);
+
+    void replay();
+
+    std::string to_string(std::vector<uint8_t> const& input)
+    {
+        return std::string(reinterpret_cast<const char*>(input.data()), input.size());
+    }
+
+    std::string path_;
+    bool read_only_;
+    std::shared_ptr<Index> index_;
+    uint64_t version_ = 0;
+    uint64_t log_size_ = 0;
+    std::ifstream reader_;
+    std::ofstream writer_;
+    std::unordered_map<std::string, std::vector<uint8_t>> puts_;
+    std::set<std::string> deletes_;
+};
+
+} // namespace bb::stdlib::merkle_tree
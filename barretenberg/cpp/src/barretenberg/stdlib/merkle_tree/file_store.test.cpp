@@ -0,0 +1,212 @@
+#include "file_store.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "memory_store.hpp"
+#include "memory_tree.hpp"
+#include "merkle_tree.hpp"
+#include "nullifier_tree/nullifier_memory_tree.hpp"
+#include "nullifier_tree/nullifier_tree.hpp"
+#include <filesystem>
+
+using namespace bb;
+using namespace bb::stdlib::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+} // namespace
+
+using Tree = MerkleTree<FileStore, Poseidon2HashPolicy>;
+
+class FileStoreTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        path = (std::filesystem::temp_directory_path() /
+                ("merkle_file_store_" + std::to_string(engine.get_random_uint64()) + ".log"))
+                   .string();
+        // Start from an empty log, whatever an earlier run may have left behind
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    std::string path;
+};
+
+TEST_F(FileStoreTest, PutGetDelete)
+{
+    FileStore store(path);
+    std::vector<uint8_t> value;
+    EXPECT_FALSE(store.get(std::vector<uint8_t>{ 1, 2 }, value));
+
+    store.put(std::vector<uint8_t>{ 1, 2 }, { 3, 4, 5 });
+    store.put(std::vector<uint8_t>{ 6 }, { 7 });
+    EXPECT_TRUE(store.get(std::vector<uint8_t>{ 1, 2 }, value));
+    EXPECT_EQ(value, std::vector<uint8_t>({ 3, 4, 5 }));
+    store.commit();
+    EXPECT_TRUE(store.get(std::vector<uint8_t>{ 1, 2 }, value));
+    EXPECT_EQ(value, std::vector<uint8_t>({ 3, 4, 5 }));
+
+    store.del({ 1, 2 });
+    EXPECT_FALSE(store.get(std::vector<uint8_t>{ 1, 2 }, value));
+    store.rollback();
+    EXPECT_TRUE(store.get(std::vector<uint8_t>{ 1, 2 }, value));
+
+    store.del({ 1, 2 });
+    store.commit();
+    EXPECT_FALSE(store.get(std::vector<uint8_t>{ 1, 2 }, value));
+    EXPECT_TRUE(store.get(std::vector<uint8_t>{ 6 }, value));
+    EXPECT_EQ(value, std::vector<uint8_t>({ 7 }));
+    EXPECT_EQ(store.version(), 2ULL);
+}
+
+TEST_F(FileStoreTest, MatchesMemoryTree)
+{
+    constexpr size_t depth = 10;
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+    FileStore store(path);
+    Tree db(store, depth);
+
+    for (size_t i = 0; i < 64; ++i) {
+        const size_t index = engine.get_random_uint32() % (1 << depth);
+        const fr value = fr::random_element();
+        memdb.update_element(index, value);
+        db.update_element(index, value);
+        if (i % 16 == 15) {
+            store.commit();
+        }
+        EXPECT_EQ(db.get_hash_path(index), memdb.get_hash_path(index));
+    }
+    EXPECT_EQ(db.root(), memdb.root());
+}
+
+TEST_F(FileStoreTest, Reopen)
+{
+    constexpr size_t depth = 32;
+    std::vector<std::pair<size_t, fr>> updates;
+    for (size_t i = 0; i < 32; ++i) {
+        updates.emplace_back(engine.get_random_uint32(), fr::random_element());
+    }
+
+    fr root;
+    fr_hash_path path0;
+    {
+        FileStore store(path);
+        Tree db(store, depth);
+        for (const auto& [index, value] : updates) {
+            db.update_element(index, value);
+        }
+        store.commit();
+        // Uncommitted writes are not persisted
+        db.update_element(0, fr::random_element());
+        store.rollback();
+        root = db.root();
+        path0 = db.get_hash_path(updates[0].first);
+    }
+
+    FileStore store(path);
+    Tree db(store, depth);
+    EXPECT_EQ(store.version(), 1ULL);
+    EXPECT_EQ(db.root(), root);
+    EXPECT_EQ(db.get_hash_path(updates[0].first), path0);
+    EXPECT_EQ(db.size(), uint256_t(updates.back().first) + 1);
+}
+
+TEST_F(FileStoreTest, TornCommitIsDiscarded)
+{
+    constexpr size_t depth = 16;
+    fr root;
+    {
+        FileStore store(path);
+        Tree db(store, depth);
+        db.update_element(1, fr(1));
+        store.commit();
+        root = db.root();
+    }
+    const auto committed_size = std::filesystem::file_size(path);
+    {
+        FileStore store(path);
+        Tree db(store, depth);
+        db.update_element(2, fr(2));
+        store.commit();
+    }
+    // Cut the last commit short, as a crash while writing it would
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 5);
+
+    {
+        FileStore store(path);
+        Tree db(store, depth);
+        EXPECT_EQ(store.version(), 1ULL);
+        EXPECT_EQ(db.root(), root);
+        EXPECT_EQ(std::filesystem::file_size(path), committed_size);
+
+        // The log carries on from the last complete commit
+        db.update_element(3, fr(3));
+        store.commit();
+        root = db.root();
+    }
+    FileStore store(path);
+    Tree db(store, depth);
+    EXPECT_EQ(store.version(), 2ULL);
+    EXPECT_EQ(db.root(), root);
+}
+
+TEST_F(FileStoreTest, Snapshots)
+{
+    constexpr size_t depth = 20;
+    FileStore store(path);
+    Tree db(store, depth);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::vector<FileStore> snapshots;
+    std::vector<fr> roots;
+    std::vector<fr_hash_path> paths;
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            const fr value = fr::random_element();
+            db.update_element(j, value);
+            memdb.update_element(j, value);
+        }
+        store.commit();
+        snapshots.push_back(store.snapshot());
+        roots.push_back(memdb.root());
+        paths.push_back(memdb.get_hash_path(5));
+    }
+
+    // Each snapshot still serves the tree as of its commit, though later commits removed its nodes from the tree
+    for (size_t i = 0; i < snapshots.size(); ++i) {
+        Tree historical_db(snapshots[i], depth);
+        EXPECT_EQ(snapshots[i].version(), i + 1);
+        EXPECT_EQ(historical_db.root(), roots[i]);
+        EXPECT_EQ(historical_db.get_hash_path(5), paths[i]);
+    }
+    EXPECT_EQ(db.root(), roots.back());
+}
+
+TEST_F(FileStoreTest, NullifierTreeReopen)
+{
+    constexpr size_t depth = 8;
+    NullifierMemoryTree<Poseidon2HashPolicy> memdb(depth);
+    {
+        FileStore store(path);
+        NullifierTree<FileStore, Poseidon2HashPolicy> db(store, depth);
+        for (size_t i = 0; i < 16; ++i) {
+            const fr value = fr(engine.get_random_uint64());
+            memdb.update_element(value);
+            db.update_element(value);
+        }
+        store.commit();
+    }
+
+    // The reopened tree picks up where it left off, leaves included
+    FileStore store(path);
+    NullifierTree<FileStore, Poseidon2HashPolicy> db(store, depth);
+    EXPECT_EQ(db.root(), memdb.root());
+    for (size_t i = 0; i < 16; ++i) {
+        const fr value = fr(engine.get_random_uint64());
+        memdb.update_element(value);
+        db.update_element(value);
+    }
+    EXPECT_EQ(db.root(), memdb.root());
+    EXPECT_EQ(db.get_hash_path(7), memdb.get_hash_path(7));
+}
@@ -3,6 +3,7 @@
 #include "barretenberg/crypto/blake2s/blake2s.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
@@ -10,22 +11,59 @@
 
 namespace bb::stdlib::merkle_tree {
 
+/**
+ * The native trees are templated on a hashing policy, which provides:
+ *  - hash(inputs): the hash of a vector of field elements (used for leaves),
+ *  - hash_pair(lhs, rhs): the hash of two sibling nodes,
+ *  - hash_pairs(inputs): the hashes of each consecutive pair of `inputs`, i.e. a whole layer of a tree at once.
+ */
+struct PedersenHashPolicy {
+    static bb::fr hash(std::vector<bb::fr> const& inputs)
+    {
+        return crypto::pedersen_hash::hash(inputs); // uses lookup tables
+    }
+
+    static bb::fr hash_pair(bb::fr const& lhs, bb::fr const& rhs) { return hash({ lhs, rhs }); }
+
+    static std::vector<bb::fr> hash_pairs(std::vector<bb::fr> const& inputs)
+    {
+        return crypto::pedersen_hash::hash_batch(inputs, 2);
+    }
+};
+
+struct Poseidon2HashPolicy {
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    static bb::fr hash(std::vector<bb::fr> const& inputs) { return Poseidon2::hash(inputs); }
+
+    static bb::fr hash_pair(bb::fr const& lhs, bb::fr const& rhs) { return hash({ lhs, rhs }); }
+
+    static std::vector<bb::fr> hash_pairs(std::vector<bb::fr> const& inputs)
+    {
+        return Poseidon2::hash_batch(inputs, 2);
+    }
+};
+
+template <typename HashingPolicy = PedersenHashPolicy>
 inline bb::fr hash_pair_native(bb::fr const& lhs, bb::fr const& rhs)
 {
-    return crypto::pedersen_hash::hash({ lhs, rhs }); // uses lookup tables
+    return HashingPolicy::hash_pair(lhs, rhs);
 }
 
-inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
+template <typename HashingPolicy = PedersenHashPolicy> inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
 {
-    return crypto::pedersen_hash::hash(inputs); // uses lookup tables
+    return HashingPolicy::hash(inputs);
 }
 
 /**
  * Computes the root of a tree with leaves given as the vector `input`.
  *
+ * Each layer is hashed in one batch, which spreads its hashes across threads.
+ *
  * @param input: vector of leaf values.
  * @returns root as field
  */
+template <typename HashingPolicy = PedersenHashPolicy>
 inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
 {
     // Check if the input vector size is a power of 2.
@@ -33,17 +71,17 @@ inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
     ASSERT(numeric::is_power_of_two(input.size()));
     auto layer = input;
     while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
-        layer = std::move(next_layer);
+        layer = HashingPolicy::hash_pairs(layer);
     }
 
     return layer[0];
 }
 
-// TODO write test
+/**
+ * Computes all the nodes of a tree with leaves given as the vector `input`, layer by layer from the leaves up to the
+ * root, in the layout of MemoryTree::hashes_ followed by the root.
+ */
+template <typename HashingPolicy = PedersenHashPolicy>
 inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
 {
     // Check if the input vector size is a power of 2.
@@ -51,13 +89,10 @@ inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
     ASSERT(numeric::is_power_of_two(input.size()));
     auto layer = input;
     std::vector<bb::fr> tree(input);
+    tree.reserve(input.size() * 2 - 1);
     while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+        layer = HashingPolicy::hash_pairs(layer);
+        tree.insert(tree.end(), layer.begin(), layer.end());
     }
 
     return tree;
@@ -62,3 +62,25 @@ TEST(stdlib_merkle_tree_hash, compute_tree_native)
     }
     EXPECT_EQ(tree_vector.back(), mem_tree.root());
 }
+
+TEST(stdlib_merkle_tree_hash, compute_tree_native_poseidon2)
+{
+    constexpr size_t depth = 4;
+    merkle_tree::MemoryTree<merkle_tree::Poseidon2HashPolicy> mem_tree(depth);
+
+    std::vector<fr> leaves;
+    for (size_t i = 0; i < (size_t(1) << depth); i++) {
+        auto input = fr::random_element();
+        leaves.push_back(input);
+        mem_tree.update_element(i, input);
+    }
+
+    std::vector<fr> tree_vector = merkle_tree::compute_tree_native<merkle_tree::Poseidon2HashPolicy>(leaves);
+
+    for (size_t i = 0; i < tree_vector.size() - 1; i++) {
+        EXPECT_EQ(tree_vector[i], mem_tree.hashes_[i]);
+    }
+    EXPECT_EQ(tree_vector.back(), mem_tree.root());
+    EXPECT_EQ(merkle_tree::compute_tree_root_native<merkle_tree::Poseidon2HashPolicy>(leaves), mem_tree.root());
+    EXPECT_NE(merkle_tree::compute_tree_root_native(leaves), mem_tree.root());
+}
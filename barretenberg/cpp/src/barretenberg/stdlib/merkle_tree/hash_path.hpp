@@ -12,6 +12,7 @@ using fr_hash_path = std::vector<std::pair<fr, fr>>;
 using fr_sibling_path = std::vector<fr>;
 template <typename Ctx> using hash_path = std::vector<std::pair<field_t<Ctx>, field_t<Ctx>>>;
 
+template <typename HashingPolicy = PedersenHashPolicy>
 inline fr_hash_path get_new_hash_path(fr_hash_path const& old_path, uint128_t index, fr const& value)
 {
     fr_hash_path path = old_path;
@@ -23,7 +24,7 @@ inline fr_hash_path get_new_hash_path(fr_hash_path const& old_path, uint128_t in
         } else {
             path[i].first = current;
         }
-        current = hash_pair_native(path[i].first, path[i].second);
+        current = hash_pair_native<HashingPolicy>(path[i].first, path[i].second);
         index /= 2;
     }
     return path;
@@ -47,16 +48,16 @@ template <typename Ctx> inline hash_path<Ctx> create_witness_hash_path(Ctx& ctx,
     return result;
 }
 
-inline fr get_hash_path_root(fr_hash_path const& input)
+template <typename HashingPolicy = PedersenHashPolicy> inline fr get_hash_path_root(fr_hash_path const& input)
 {
-    return hash_pair_native(input[input.size() - 1].first, input[input.size() - 1].second);
+    return hash_pair_native<HashingPolicy>(input[input.size() - 1].first, input[input.size() - 1].second);
 }
 
-inline fr zero_hash_at_height(size_t height)
+template <typename HashingPolicy = PedersenHashPolicy> inline fr zero_hash_at_height(size_t height)
 {
     auto current = fr(0);
     for (size_t i = 0; i < height; ++i) {
-        current = hash_pair_native(current, current);
+        current = hash_pair_native<HashingPolicy>(current, current);
     }
     return current;
 }
@@ -3,7 +3,8 @@
 
 namespace bb::stdlib::merkle_tree {
 
-MemoryTree::MemoryTree(size_t depth)
+template <typename HashingPolicy>
+MemoryTree<HashingPolicy>::MemoryTree(size_t depth)
     : depth_(depth)
 {
 
@@ -18,13 +19,43 @@ MemoryTree::MemoryTree(size_t depth)
         for (size_t i = 0; i < layer_size; ++i) {
             hashes_[offset + i] = current;
         }
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 
     root_ = current;
 }
 
-fr_hash_path MemoryTree::get_hash_path(size_t index)
+template <typename HashingPolicy>
+MemoryTree<HashingPolicy>::MemoryTree(size_t depth, std::vector<fr> const& leaves)
+    : depth_(depth)
+{
+    ASSERT(depth_ >= 1 && depth <= 20);
+    total_size_ = 1UL << depth_;
+    ASSERT(leaves.size() <= total_size_);
+    hashes_.resize(total_size_ * 2 - 2);
+
+    // Build the tree layer by layer. Only the prefix of each layer above the leaves is hashed, the rest of the layer
+    // being the zero hash at that height.
+    auto zero = fr(0);
+    std::vector<fr> layer = leaves;
+    size_t layer_size = total_size_;
+    for (size_t offset = 0; offset < hashes_.size(); offset += layer_size, layer_size /= 2) {
+        if (layer.size() % 2 == 1) {
+            layer.push_back(zero);
+        }
+        auto layer_start = hashes_.begin() + static_cast<std::ptrdiff_t>(offset);
+        std::copy(layer.begin(), layer.end(), layer_start);
+        std::fill(layer_start + static_cast<std::ptrdiff_t>(layer.size()),
+                  layer_start + static_cast<std::ptrdiff_t>(layer_size),
+                  zero);
+        layer = HashingPolicy::hash_pairs(layer);
+        zero = HashingPolicy::hash_pair(zero, zero);
+    }
+
+    root_ = layer.empty() ? zero : layer[0];
+}
+
+template <typename HashingPolicy> fr_hash_path MemoryTree<HashingPolicy>::get_hash_path(size_t index)
 {
     fr_hash_path path(depth_);
     size_t offset = 0;
@@ -39,7 +70,7 @@ fr_hash_path MemoryTree::get_hash_path(size_t index)
     return path;
 }
 
-fr_sibling_path MemoryTree::get_sibling_path(size_t index)
+template <typename HashingPolicy> fr_sibling_path MemoryTree<HashingPolicy>::get_sibling_path(size_t index)
 {
     fr_sibling_path path(depth_);
     size_t offset = 0;
@@ -57,7 +88,7 @@ fr_sibling_path MemoryTree::get_sibling_path(size_t index)
     return path;
 }
 
-fr MemoryTree::update_element(size_t index, fr const& value)
+template <typename HashingPolicy> fr MemoryTree<HashingPolicy>::update_element(size_t index, fr const& value)
 {
     size_t offset = 0;
     size_t layer_size = total_size_;
@@ -65,7 +96,7 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     for (size_t i = 0; i < depth_; ++i) {
         hashes_[offset + index] = current;
         index &= (~0ULL) - 1;
-        current = hash_pair_native(hashes_[offset + index], hashes_[offset + index + 1]);
+        current = HashingPolicy::hash_pair(hashes_[offset + index], hashes_[offset + index + 1]);
         offset += layer_size;
         layer_size >>= 1;
         index >>= 1;
@@ -74,4 +105,7 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     return root_;
 }
 
+template class MemoryTree<PedersenHashPolicy>;
+template class MemoryTree<Poseidon2HashPolicy>;
+
 } // namespace bb::stdlib::merkle_tree
\ No newline at end of file
@@ -20,12 +20,18 @@ using namespace bb;
  *
  * Here, depth_ = 3 and {h_{0,j}}_{i=0..7} are leaf values.
  * Also, root_ = h_{3,0} and total_size_ = (2 * 8 - 2) = 14.
- * Lastly, h_{i,j} = hash( h_{i-1,2j}, h_{i-1,2j+1} ) where i > 1.
+ * Lastly, h_{i,j} = hash( h_{i-1,2j}, h_{i-1,2j+1} ) where i > 1, with the hash given by `HashingPolicy`.
  */
-class MemoryTree {
+template <typename HashingPolicy = PedersenHashPolicy> class MemoryTree {
   public:
     MemoryTree(size_t depth);
 
+    /**
+     * Builds the tree with `leaves` at indices 0, 1, ... and zeroes elsewhere, hashing the non-zero part of each layer
+     * in one batch.
+     */
+    MemoryTree(size_t depth, std::vector<fr> const& leaves);
+
     fr_hash_path get_hash_path(size_t index);
 
     fr_sibling_path get_sibling_path(size_t index);
@@ -78,3 +78,26 @@ TEST(stdlib_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(stdlib_merkle_tree, test_memory_tree_from_leaves)
+{
+    constexpr size_t depth = 3;
+    // Leaves filling none, part and all of the tree, including an odd number of them
+    for (const size_t num_leaves : std::vector<size_t>{ 0, 3, 5, 8 }) {
+        std::vector<fr> leaves(num_leaves);
+        MemoryTree db(depth);
+        MemoryTree<Poseidon2HashPolicy> poseidon2_db(depth);
+        for (size_t i = 0; i < num_leaves; ++i) {
+            leaves[i] = fr::random_element();
+            db.update_element(i, leaves[i]);
+            poseidon2_db.update_element(i, leaves[i]);
+        }
+
+        MemoryTree bulk_db(depth, leaves);
+        MemoryTree<Poseidon2HashPolicy> bulk_poseidon2_db(depth, leaves);
+        EXPECT_EQ(bulk_db.hashes_, db.hashes_);
+        EXPECT_EQ(bulk_db.root(), db.root());
+        EXPECT_EQ(bulk_poseidon2_db.hashes_, poseidon2_db.hashes_);
+        EXPECT_EQ(bulk_poseidon2_db.root(), poseidon2_db.root());
+    }
+}
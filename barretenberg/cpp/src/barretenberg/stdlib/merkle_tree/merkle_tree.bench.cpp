@@ -1,7 +1,9 @@
 #include "merkle_tree.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
+#include "memory_tree.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -22,38 +24,41 @@ static std::vector<fr> VALUES = []() {
     return values;
 }();
 
-void hash(State& state) noexcept
+template <typename HashingPolicy> void hash(State& state) noexcept
 {
     for (auto _ : state) {
-        hash_pair_native({ 0, 0, 0, 0 }, { 1, 1, 1, 1 });
+        HashingPolicy::hash_pair({ 0, 0, 0, 0 }, { 1, 1, 1, 1 });
     }
 }
-BENCHMARK(hash)->MinTime(5);
+BENCHMARK(hash<PedersenHashPolicy>)->MinTime(5);
+BENCHMARK(hash<Poseidon2HashPolicy>)->MinTime(5);
 
-void update_first_element(State& state) noexcept
+template <typename HashingPolicy> void update_first_element(State& state) noexcept
 {
     MemoryStore store;
-    MerkleTree<MemoryStore> db(store, DEPTH);
+    MerkleTree<MemoryStore, HashingPolicy> db(store, DEPTH);
 
     for (auto _ : state) {
         db.update_element(0, VALUES[1]);
     }
 }
-BENCHMARK(update_first_element)->Unit(benchmark::kMillisecond);
+BENCHMARK(update_first_element<PedersenHashPolicy>)->Unit(benchmark::kMillisecond);
+BENCHMARK(update_first_element<Poseidon2HashPolicy>)->Unit(benchmark::kMillisecond);
 
-void update_elements(State& state) noexcept
+template <typename HashingPolicy> void update_elements(State& state) noexcept
 {
     for (auto _ : state) {
         state.PauseTiming();
         MemoryStore store;
-        MerkleTree<MemoryStore> db(store, DEPTH);
+        MerkleTree<MemoryStore, HashingPolicy> db(store, DEPTH);
         state.ResumeTiming();
         for (size_t i = 0; i < (size_t)state.range(0); ++i) {
             db.update_element(i, VALUES[i]);
         }
     }
 }
-BENCHMARK(update_elements)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+BENCHMARK(update_elements<PedersenHashPolicy>)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+BENCHMARK(update_elements<Poseidon2HashPolicy>)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
 
 void update_random_elements(State& state) noexcept
 {
@@ -71,4 +76,39 @@ void update_random_elements(State& state) noexcept
 }
 BENCHMARK(update_random_elements)->Unit(benchmark::kMillisecond)->Range(100, 100)->Iterations(1);
 
+/**
+ * @brief Build a whole tree of 2^range(0) leaves in one go, hashing a layer at a time across threads
+ */
+template <typename HashingPolicy> void compute_tree_root(State& state) noexcept
+{
+    std::vector<fr> leaves(VALUES.begin(), VALUES.begin() + state.range(0));
+    for (auto _ : state) {
+        DoNotOptimize(compute_tree_root_native<HashingPolicy>(leaves));
+    }
+}
+BENCHMARK(compute_tree_root<PedersenHashPolicy>)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+BENCHMARK(compute_tree_root<Poseidon2HashPolicy>)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+
+/**
+ * @brief The same tree built one leaf at a time, for comparison
+ */
+template <typename HashingPolicy> void memory_tree_update_elements(State& state) noexcept
+{
+    const auto depth = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(state.range(0))));
+    for (auto _ : state) {
+        MemoryTree<HashingPolicy> db(depth);
+        for (size_t i = 0; i < static_cast<size_t>(state.range(0)); ++i) {
+            db.update_element(i, VALUES[i]);
+        }
+    }
+}
+BENCHMARK(memory_tree_update_elements<PedersenHashPolicy>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(256, MAX);
+BENCHMARK(memory_tree_update_elements<Poseidon2HashPolicy>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(256, MAX);
+
 BENCHMARK_MAIN();
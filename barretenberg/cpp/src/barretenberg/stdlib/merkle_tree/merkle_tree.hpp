@@ -7,8 +7,9 @@ namespace bb::stdlib::merkle_tree {
 using namespace bb;
 
 class MemoryStore;
+class FileStore;
 
-template <typename Store> class MerkleTree {
+template <typename Store, typename HashingPolicy = PedersenHashPolicy> class MerkleTree {
   public:
     typedef uint256_t index_t;
 
@@ -53,6 +53,24 @@ TEST(stdlib_merkle_tree, test_kv_memory_vs_memory_consistency)
     EXPECT_EQ(db.root(), memdb.root());
 }
 
+TEST(stdlib_merkle_tree, test_kv_memory_vs_memory_consistency_poseidon2)
+{
+    constexpr size_t depth = 10;
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    MemoryStore store;
+    MerkleTree<MemoryStore, Poseidon2HashPolicy> db(store, depth);
+
+    for (size_t i = 0; i < 64; ++i) {
+        size_t idx = engine.get_random_uint32() % (1 << depth);
+        memdb.update_element(idx, VALUES[i]);
+        db.update_element(idx, VALUES[i]);
+        EXPECT_EQ(db.get_hash_path(idx), memdb.get_hash_path(idx));
+    }
+
+    EXPECT_EQ(db.root(), memdb.root());
+}
+
 TEST(stdlib_merkle_tree, test_size)
 {
     MemoryStore store;
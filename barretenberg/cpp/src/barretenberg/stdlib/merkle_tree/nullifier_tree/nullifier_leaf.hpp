@@ -1,6 +1,8 @@
 #pragma once
+#include "../hash.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
+#include <map>
 
 namespace bb::stdlib::merkle_tree {
 
@@ -22,7 +24,10 @@ struct nullifier_leaf {
         return os;
     }
 
-    bb::fr hash() const { return stdlib::merkle_tree::hash_native({ value, nextIndex, nextValue }); }
+    template <typename HashingPolicy = PedersenHashPolicy> bb::fr hash() const
+    {
+        return HashingPolicy::hash({ value, nextIndex, nextValue });
+    }
 };
 
 /**
@@ -70,7 +75,10 @@ class WrappedNullifierLeaf {
      *
      * @return bb::fr
      */
-    bb::fr hash() const { return data.has_value() ? data.value().hash() : bb::fr::zero(); }
+    template <typename HashingPolicy = PedersenHashPolicy> bb::fr hash() const
+    {
+        return data.has_value() ? data.value().hash<HashingPolicy>() : bb::fr::zero();
+    }
 
     /**
      * @brief Generate a zero leaf (call the constructor with no arguments)
@@ -111,4 +119,33 @@ inline std::pair<size_t, bool> find_closest_leaf(std::vector<WrappedNullifierLea
     return std::make_pair(static_cast<size_t>(it - diff.begin()), repeated);
 }
 
+/**
+ * @brief An ordered index from the values of the (non-empty) leaves of a nullifier tree to their indices
+ * @details Kept alongside the leaves, so that the low leaf of a new value is found in O(log n) rather than by a scan of
+ * all the leaves as in find_closest_leaf.
+ */
+class NullifierLeafIndex {
+  public:
+    void insert(fr const& value, size_t index) { indices_[uint256_t(value)] = index; }
+
+    /**
+     * @brief The same as find_closest_leaf: the index of the leaf holding `new_value` and true if there is one, and
+     * otherwise the index of the leaf with the greatest value less than `new_value` and false
+     * @details The zero leaf at index 0 is always present, so there always is such a leaf.
+     */
+    std::pair<size_t, bool> find_low_leaf(fr const& new_value) const
+    {
+        auto new_value_ = uint256_t(new_value);
+        auto it = std::prev(indices_.upper_bound(new_value_));
+        return std::make_pair(it->second, it->first == new_value_);
+    }
+
+    bool contains(fr const& value) const { return indices_.contains(uint256_t(value)); }
+
+    size_t size() const { return indices_.size(); }
+
+  private:
+    std::map<uint256_t, size_t> indices_;
+};
+
 } // namespace bb::stdlib::merkle_tree
@@ -0,0 +1,102 @@
+#include "nullifier_memory_tree.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb::stdlib::merkle_tree;
+
+namespace {
+auto& engine = bb::numeric::get_debug_randomness();
+
+constexpr size_t NUM_LEAVES = 1 << 20;
+// Leaves room for the insertions of the benchmarks below
+constexpr size_t DEPTH = 21;
+
+std::vector<fr> random_values(size_t num_values)
+{
+    std::vector<fr> values(num_values);
+    for (auto& value : values) {
+        value = fr(engine.get_random_uint256());
+    }
+    return values;
+}
+
+/**
+ * @brief A tree of NUM_LEAVES leaves, built once and shared by the insertion benchmarks
+ */
+NullifierMemoryTree<Poseidon2HashPolicy>& get_tree()
+{
+    static NullifierMemoryTree<Poseidon2HashPolicy> tree = [] {
+        NullifierMemoryTree<Poseidon2HashPolicy> tree(DEPTH);
+        tree.update_elements(random_values(NUM_LEAVES - 1));
+        return tree;
+    }();
+    return tree;
+}
+} // namespace
+
+/**
+ * @brief Finding the low leaf of a value among NUM_LEAVES leaves by scanning them all
+ */
+void low_leaf_scan(State& state) noexcept
+{
+    std::vector<WrappedNullifierLeaf> leaves;
+    for (auto const& value : random_values(NUM_LEAVES)) {
+        leaves.push_back(WrappedNullifierLeaf(nullifier_leaf{ value, 0, 0 }));
+    }
+    for (auto _ : state) {
+        DoNotOptimize(find_closest_leaf(leaves, fr(engine.get_random_uint256())));
+    }
+}
+BENCHMARK(low_leaf_scan)->Unit(kMillisecond);
+
+/**
+ * @brief Finding the low leaf of a value among NUM_LEAVES leaves with the ordered index
+ */
+void low_leaf_index(State& state) noexcept
+{
+    NullifierLeafIndex leaf_index;
+    leaf_index.insert(0, 0);
+    auto values = random_values(NUM_LEAVES - 1);
+    for (size_t i = 0; i < values.size(); ++i) {
+        leaf_index.insert(values[i], i + 1);
+    }
+    for (auto _ : state) {
+        DoNotOptimize(leaf_index.find_low_leaf(fr(engine.get_random_uint256())));
+    }
+}
+BENCHMARK(low_leaf_index);
+
+/**
+ * @brief Inserting range(0) values one at a time into a tree of NUM_LEAVES leaves
+ */
+void insert_one_at_a_time(State& state) noexcept
+{
+    auto& tree = get_tree();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto values = random_values(static_cast<size_t>(state.range(0)));
+        state.ResumeTiming();
+        for (auto const& value : values) {
+            tree.update_element(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(insert_one_at_a_time)->Unit(kMillisecond)->RangeMultiplier(8)->Range(64, 4096);
+
+/**
+ * @brief Inserting range(0) values as one batch into a tree of NUM_LEAVES leaves
+ */
+void insert_batch(State& state) noexcept
+{
+    auto& tree = get_tree();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto values = random_values(static_cast<size_t>(state.range(0)));
+        state.ResumeTiming();
+        tree.update_elements(values);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(insert_batch)->Unit(kMillisecond)->RangeMultiplier(8)->Range(64, 4096);
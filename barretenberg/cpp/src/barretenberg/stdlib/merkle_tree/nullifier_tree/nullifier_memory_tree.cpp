@@ -1,32 +1,35 @@
 #include "nullifier_memory_tree.hpp"
 #include "../hash.hpp"
+#include <set>
 
 namespace bb::stdlib::merkle_tree {
 
-NullifierMemoryTree::NullifierMemoryTree(size_t depth)
-    : MemoryTree(depth)
+template <typename HashingPolicy>
+NullifierMemoryTree<HashingPolicy>::NullifierMemoryTree(size_t depth)
+    : MemoryTree<HashingPolicy>(depth)
 {
     ASSERT(depth_ >= 1 && depth <= 32);
     total_size_ = 1UL << depth_;
     hashes_.resize(total_size_ * 2 - 2);
 
     // Build the entire tree and fill with 0 hashes.
-    auto current = WrappedNullifierLeaf::zero().hash();
+    auto current = WrappedNullifierLeaf::zero().hash<HashingPolicy>();
     size_t layer_size = total_size_;
     for (size_t offset = 0; offset < hashes_.size(); offset += layer_size, layer_size /= 2) {
         for (size_t i = 0; i < layer_size; ++i) {
             hashes_[offset + i] = current;
         }
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 
     // Insert the initial leaf at index 0
     auto initial_leaf = WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves_.push_back(initial_leaf);
-    root_ = update_element(0, initial_leaf.hash());
+    leaf_index_.insert(0, 0);
+    root_ = update_element(0, initial_leaf.hash<HashingPolicy>());
 }
 
-fr NullifierMemoryTree::update_element(fr const& value)
+template <typename HashingPolicy> fr NullifierMemoryTree<HashingPolicy>::update_element(fr const& value)
 {
     // Find the leaf with the value closest and less than `value`
 
@@ -34,12 +37,12 @@ fr NullifierMemoryTree::update_element(fr const& value)
     if (value == 0) {
         auto zero_leaf = WrappedNullifierLeaf::zero();
         leaves_.push_back(zero_leaf);
-        return update_element(leaves_.size() - 1, zero_leaf.hash());
+        return update_element(leaves_.size() - 1, zero_leaf.hash<HashingPolicy>());
     }
 
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
+    std::tie(current, is_already_present) = leaf_index_.find_low_leaf(value);
 
     nullifier_leaf current_leaf = leaves_[current].unwrap();
     nullifier_leaf new_leaf = { .value = value,
@@ -55,19 +58,99 @@ fr NullifierMemoryTree::update_element(fr const& value)
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
         leaves_.push_back(new_leaf);
+        leaf_index_.insert(value, leaves_.size() - 1);
     }
 
     // Update the old leaf in the tree
-    auto old_leaf_hash = current_leaf.hash();
+    auto old_leaf_hash = current_leaf.hash<HashingPolicy>();
     size_t old_leaf_index = current;
     auto root = update_element(old_leaf_index, old_leaf_hash);
 
     // Insert the new leaf in the tree
-    auto new_leaf_hash = new_leaf.hash();
+    auto new_leaf_hash = new_leaf.hash<HashingPolicy>();
     size_t new_leaf_index = is_already_present ? old_leaf_index : leaves_.size() - 1;
     root = update_element(new_leaf_index, new_leaf_hash);
 
     return root;
 }
 
+template <typename HashingPolicy>
+fr NullifierMemoryTree<HashingPolicy>::update_elements(std::vector<fr> const& values)
+{
+    // Append the leaves in the order of `values`, as update_element would: a zero value appends an empty leaf, and a
+    // value already in the tree (or earlier in the batch) appends nothing.
+    std::vector<size_t> updated_leaves;
+    std::vector<std::pair<uint256_t, size_t>> new_leaves;
+    std::set<uint256_t> batch_values;
+    for (auto const& value : values) {
+        if (value == 0) {
+            leaves_.push_back(WrappedNullifierLeaf::zero());
+            updated_leaves.push_back(leaves_.size() - 1);
+        } else if (!leaf_index_.contains(value) && batch_values.insert(uint256_t(value)).second) {
+            leaves_.push_back(WrappedNullifierLeaf::zero());
+            new_leaves.emplace_back(uint256_t(value), leaves_.size() - 1);
+        }
+    }
+    ASSERT(leaves_.size() <= total_size_);
+
+    // Link the new leaves into the list in increasing order of value. The low leaf of each is either its low leaf
+    // among the leaves before the batch or, if greater, the new leaf linked just before it.
+    std::sort(new_leaves.begin(), new_leaves.end());
+    for (size_t i = 0; i < new_leaves.size(); ++i) {
+        auto const& [value, index] = new_leaves[i];
+        size_t low_index = leaf_index_.find_low_leaf(value).first;
+        if (i > 0 && new_leaves[i - 1].first > uint256_t(leaves_[low_index].unwrap().value)) {
+            low_index = new_leaves[i - 1].second;
+        }
+        nullifier_leaf low_leaf = leaves_[low_index].unwrap();
+        leaves_[index].set({ .value = value, .nextIndex = low_leaf.nextIndex, .nextValue = low_leaf.nextValue });
+        low_leaf.nextIndex = index;
+        low_leaf.nextValue = value;
+        leaves_[low_index].set(low_leaf);
+        updated_leaves.push_back(low_index);
+        updated_leaves.push_back(index);
+    }
+    for (auto const& [value, index] : new_leaves) {
+        leaf_index_.insert(value, index);
+    }
+
+    // Rehash the updated leaves and then, a layer at a time, their ancestors
+    std::sort(updated_leaves.begin(), updated_leaves.end());
+    updated_leaves.erase(std::unique(updated_leaves.begin(), updated_leaves.end()), updated_leaves.end());
+    for (size_t index : updated_leaves) {
+        hashes_[index] = leaves_[index].hash<HashingPolicy>();
+    }
+    std::vector<size_t> nodes = std::move(updated_leaves);
+    std::vector<fr> children;
+    size_t offset = 0;
+    size_t layer_size = total_size_;
+    for (size_t i = 0; i < depth_ && !nodes.empty(); ++i) {
+        // The parents of this layer's updated nodes, each once, with their pairs of children
+        std::vector<size_t> parents;
+        children.clear();
+        for (size_t index : nodes) {
+            if (parents.empty() || parents.back() != index / 2) {
+                parents.push_back(index / 2);
+                children.push_back(hashes_[offset + (index & ~size_t(1))]);
+                children.push_back(hashes_[offset + (index | 1)]);
+            }
+        }
+        auto parent_hashes = HashingPolicy::hash_pairs(children);
+        offset += layer_size;
+        layer_size >>= 1;
+        if (i + 1 == depth_) {
+            root_ = parent_hashes[0];
+        } else {
+            for (size_t j = 0; j < parents.size(); ++j) {
+                hashes_[offset + parents[j]] = parent_hashes[j];
+            }
+        }
+        nodes = std::move(parents);
+    }
+    return root_;
+}
+
+template class NullifierMemoryTree<PedersenHashPolicy>;
+template class NullifierMemoryTree<Poseidon2HashPolicy>;
+
 } // namespace bb::stdlib::merkle_tree
\ No newline at end of file
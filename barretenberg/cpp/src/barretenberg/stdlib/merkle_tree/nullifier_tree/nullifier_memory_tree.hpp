@@ -63,17 +63,24 @@ namespace bb::stdlib::merkle_tree {
  *  nextIdx   2       4       3       1        0       0       0       0
  *  nextVal   10      50      20      30       0       0       0       0
  */
-class NullifierMemoryTree : public MemoryTree {
+template <typename HashingPolicy = PedersenHashPolicy> class NullifierMemoryTree : public MemoryTree<HashingPolicy> {
 
   public:
     NullifierMemoryTree(size_t depth);
 
-    using MemoryTree::get_hash_path;
-    using MemoryTree::root;
-    using MemoryTree::update_element;
+    using MemoryTree<HashingPolicy>::get_hash_path;
+    using MemoryTree<HashingPolicy>::root;
+    using MemoryTree<HashingPolicy>::update_element;
 
     fr update_element(fr const& value);
 
+    /**
+     * Inserts `values` with the same result as calling update_element on each of them in turn, but resolves all their
+     * low leaves in one pass over the values in sorted order, and then rehashes each affected node of the tree once,
+     * hashing a layer at a time.
+     */
+    fr update_elements(std::vector<fr> const& values);
+
     const std::vector<bb::fr>& get_hashes() { return hashes_; }
     const WrappedNullifierLeaf get_leaf(size_t index)
     {
@@ -82,11 +89,12 @@ class NullifierMemoryTree : public MemoryTree {
     const std::vector<WrappedNullifierLeaf>& get_leaves() { return leaves_; }
 
   protected:
-    using MemoryTree::depth_;
-    using MemoryTree::hashes_;
-    using MemoryTree::root_;
-    using MemoryTree::total_size_;
+    using MemoryTree<HashingPolicy>::depth_;
+    using MemoryTree<HashingPolicy>::hashes_;
+    using MemoryTree<HashingPolicy>::root_;
+    using MemoryTree<HashingPolicy>::total_size_;
     std::vector<WrappedNullifierLeaf> leaves_;
+    NullifierLeafIndex leaf_index_;
 };
 
 } // namespace bb::stdlib::merkle_tree
\ No newline at end of file
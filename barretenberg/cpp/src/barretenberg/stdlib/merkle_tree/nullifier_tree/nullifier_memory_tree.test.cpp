@@ -368,4 +368,57 @@ TEST(crypto_nullifier_tree, test_nullifier_tree)
     // Merkle proof at `index` proves non-membership of `new_member`
     auto hash_path = tree.get_hash_path(index);
     EXPECT_TRUE(check_hash_path(tree.root(), hash_path, leaves[index].unwrap(), index));
-}
\ No newline at end of file
+}
+TEST(crypto_nullifier_tree, test_leaf_index_matches_scan)
+{
+    std::vector<WrappedNullifierLeaf> leaves = { WrappedNullifierLeaf(nullifier_leaf{ 0, 0, 0 }) };
+    NullifierLeafIndex leaf_index;
+    leaf_index.insert(0, 0);
+    for (size_t i = 0; i < 64; i++) {
+        if (i % 8 == 0) {
+            leaves.push_back(WrappedNullifierLeaf::zero());
+            continue;
+        }
+        auto value = fr::random_element();
+        leaves.push_back(WrappedNullifierLeaf(nullifier_leaf{ value, 0, 0 }));
+        leaf_index.insert(value, leaves.size() - 1);
+    }
+
+    for (size_t i = 0; i < 64; i++) {
+        auto value = fr::random_element();
+        EXPECT_EQ(leaf_index.find_low_leaf(value), find_closest_leaf(leaves, value));
+    }
+    for (size_t i = 0; i < leaves.size(); i++) {
+        auto value = leaves[i].has_value() ? leaves[i].unwrap().value : fr(0);
+        EXPECT_EQ(leaf_index.find_low_leaf(value), find_closest_leaf(leaves, value));
+    }
+}
+
+TEST(crypto_nullifier_tree, test_batch_insertion)
+{
+    constexpr size_t depth = 8;
+    NullifierMemoryTree<Poseidon2HashPolicy> tree(depth);
+    NullifierMemoryTree<Poseidon2HashPolicy> batch_tree(depth);
+
+    std::vector<fr> values;
+    for (size_t i = 0; i < 32; i++) {
+        values.push_back(fr::random_element());
+    }
+    // Zero values, values repeated within the batch and values already in the tree
+    values[5] = 0;
+    values[9] = values[3];
+    tree.update_element(values[20]);
+    batch_tree.update_element(values[20]);
+
+    // Two batches, the second with its values linked in among the first's
+    const std::vector<fr> first_batch(values.begin(), values.begin() + 16);
+    const std::vector<fr> second_batch(values.begin() + 16, values.end());
+    for (auto const& batch : { first_batch, second_batch }) {
+        for (auto const& value : batch) {
+            tree.update_element(value);
+        }
+        EXPECT_EQ(batch_tree.update_elements(batch), tree.root());
+        EXPECT_EQ(batch_tree.get_leaves(), tree.get_leaves());
+        EXPECT_EQ(batch_tree.get_hashes(), tree.get_hashes());
+    }
+}
@@ -1,4 +1,5 @@
 #include "nullifier_tree.hpp"
+#include "../file_store.hpp"
 #include "../hash.hpp"
 #include "../memory_store.hpp"
 #include "../merkle_tree.hpp"
@@ -16,41 +17,57 @@ template <typename T> inline bool bit_set(T const& index, size_t i)
     return bool((index >> i) & 0x1);
 }
 
-template <typename Store>
-NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
-    : MerkleTree<Store>(store, depth, tree_id)
+template <typename Store, typename HashingPolicy>
+NullifierTree<Store, HashingPolicy>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
+    : MerkleTree<Store, HashingPolicy>(store, depth, tree_id)
 {
     ASSERT(depth_ >= 1 && depth <= 256);
     zero_hashes_.resize(depth);
 
+    // Reload the leaves of a tree already in the store (e.g. a persistent one, on restart).
+    std::vector<uint8_t> leaf_buf;
+    while (store_.get(leaf_key(leaves.size()), leaf_buf)) {
+        leaves.push_back(WrappedNullifierLeaf(nullifier_leaf{ .value = from_buffer<fr>(leaf_buf, 0),
+                                                               .nextIndex = from_buffer<index_t>(leaf_buf, 32),
+                                                               .nextValue = from_buffer<fr>(leaf_buf, 64) }));
+        leaf_index.insert(leaves.back().unwrap().value, leaves.size() - 1);
+    }
+
     // Compute the zero values at each layer.
-    // Insert the zero leaf to the `leaves` and also to the tree at index 0.
-    WrappedNullifierLeaf initial_leaf =
-        WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
-    leaves.push_back(initial_leaf);
-    update_element(0, initial_leaf.hash());
+    // Otherwise, insert the zero leaf to the `leaves` and also to the tree at index 0.
+    if (leaves.empty()) {
+        WrappedNullifierLeaf initial_leaf =
+            WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
+        leaves.push_back(initial_leaf);
+        leaf_index.insert(0, 0);
+        put_leaf(0, initial_leaf.unwrap());
+        update_element(0, initial_leaf.hash<HashingPolicy>());
+    }
 
     // Create the zero hashes for the tree
-    auto current = WrappedNullifierLeaf::zero().hash();
+    auto current = WrappedNullifierLeaf::zero().hash<HashingPolicy>();
     for (size_t i = 0; i < depth; ++i) {
         zero_hashes_[i] = current;
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 }
 
-template <typename Store>
-NullifierTree<Store>::NullifierTree(NullifierTree&& other)
-    : MerkleTree<Store>(std::move(other))
+template <typename Store, typename HashingPolicy>
+NullifierTree<Store, HashingPolicy>::NullifierTree(NullifierTree&& other)
+    : MerkleTree<Store, HashingPolicy>(std::move(other))
+    , leaves(std::move(other.leaves))
+    , leaf_index(std::move(other.leaf_index))
 {}
 
-template <typename Store> NullifierTree<Store>::~NullifierTree() {}
+template <typename Store, typename HashingPolicy> NullifierTree<Store, HashingPolicy>::~NullifierTree() {}
 
-template <typename Store> fr NullifierTree<Store>::update_element(fr const& value)
+template <typename Store, typename HashingPolicy>
+fr NullifierTree<Store, HashingPolicy>::update_element(fr const& value)
 {
     // Find the leaf with the value closest and less than `value`
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves, value);
+    std::tie(current, is_already_present) = leaf_index.find_low_leaf(value);
 
     nullifier_leaf current_leaf = leaves[current].unwrap();
     WrappedNullifierLeaf new_leaf = WrappedNullifierLeaf(
@@ -64,21 +81,50 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
         leaves.push_back(new_leaf);
+        leaf_index.insert(value, leaves.size() - 1);
+
+        put_leaf(current, current_leaf);
+        put_leaf(leaves.size() - 1, new_leaf.unwrap());
     }
 
     // Update the old leaf in the tree
-    auto old_leaf_hash = leaves[current].hash();
+    auto old_leaf_hash = leaves[current].hash<HashingPolicy>();
     index_t old_leaf_index = current;
     auto r = update_element(old_leaf_index, old_leaf_hash);
 
     // Insert the new leaf in the tree
-    auto new_leaf_hash = new_leaf.hash();
+    auto new_leaf_hash = new_leaf.hash<HashingPolicy>();
     index_t new_leaf_index = is_already_present ? old_leaf_index : leaves.size() - 1;
     r = update_element(new_leaf_index, new_leaf_hash);
 
     return r;
 }
 
-template class NullifierTree<MemoryStore>;
+template <typename Store, typename HashingPolicy>
+std::vector<uint8_t> NullifierTree<Store, HashingPolicy>::leaf_key(index_t index) const
+{
+    // Distinct from the keys of the underlying tree: its metadata (1 byte), leaves (33 bytes) and nodes (32 bytes)
+    using serialize::write;
+    std::vector<uint8_t> key = { tree_id_ };
+    write(key, index);
+    key.push_back(LEAF_PREIMAGE_KEY_SUFFIX);
+    return key;
+}
+
+template <typename Store, typename HashingPolicy>
+void NullifierTree<Store, HashingPolicy>::put_leaf(index_t index, nullifier_leaf const& leaf)
+{
+    using serialize::write;
+    std::vector<uint8_t> buf;
+    write(buf, leaf.value);
+    write(buf, leaf.nextIndex);
+    write(buf, leaf.nextValue);
+    store_.put(leaf_key(index), buf);
+}
+
+template class NullifierTree<MemoryStore, PedersenHashPolicy>;
+template class NullifierTree<MemoryStore, Poseidon2HashPolicy>;
+template class NullifierTree<FileStore, PedersenHashPolicy>;
+template class NullifierTree<FileStore, Poseidon2HashPolicy>;
 
 } // namespace bb::stdlib::merkle_tree
\ No newline at end of file
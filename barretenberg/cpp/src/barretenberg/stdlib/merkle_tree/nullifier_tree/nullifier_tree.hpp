@@ -7,7 +7,8 @@ namespace bb::stdlib::merkle_tree {
 
 using namespace bb;
 
-template <typename Store> class NullifierTree : public MerkleTree<Store> {
+template <typename Store, typename HashingPolicy = PedersenHashPolicy>
+class NullifierTree : public MerkleTree<Store, HashingPolicy> {
   public:
     typedef uint256_t index_t;
 
@@ -16,24 +17,32 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
     NullifierTree(NullifierTree&& other);
     ~NullifierTree();
 
-    using MerkleTree<Store>::get_hash_path;
-    using MerkleTree<Store>::root;
-    using MerkleTree<Store>::size;
-    using MerkleTree<Store>::depth;
+    using MerkleTree<Store, HashingPolicy>::get_hash_path;
+    using MerkleTree<Store, HashingPolicy>::root;
+    using MerkleTree<Store, HashingPolicy>::size;
+    using MerkleTree<Store, HashingPolicy>::depth;
 
     fr update_element(fr const& value);
 
   private:
-    using MerkleTree<Store>::update_element;
-    using MerkleTree<Store>::get_element;
-    using MerkleTree<Store>::compute_zero_path_hash;
+    // The leaf preimages are kept in the store next to the tree, so that a tree in a persistent store can be reopened
+    static constexpr uint8_t LEAF_PREIMAGE_KEY_SUFFIX = 1;
+
+    std::vector<uint8_t> leaf_key(index_t index) const;
+
+    void put_leaf(index_t index, nullifier_leaf const& leaf);
+
+    using MerkleTree<Store, HashingPolicy>::update_element;
+    using MerkleTree<Store, HashingPolicy>::get_element;
+    using MerkleTree<Store, HashingPolicy>::compute_zero_path_hash;
 
   private:
-    using MerkleTree<Store>::store_;
-    using MerkleTree<Store>::zero_hashes_;
-    using MerkleTree<Store>::depth_;
-    using MerkleTree<Store>::tree_id_;
+    using MerkleTree<Store, HashingPolicy>::store_;
+    using MerkleTree<Store, HashingPolicy>::zero_hashes_;
+    using MerkleTree<Store, HashingPolicy>::depth_;
+    using MerkleTree<Store, HashingPolicy>::tree_id_;
     std::vector<WrappedNullifierLeaf> leaves;
+    NullifierLeafIndex leaf_index;
 };
 
 } // namespace bb::stdlib::merkle_tree
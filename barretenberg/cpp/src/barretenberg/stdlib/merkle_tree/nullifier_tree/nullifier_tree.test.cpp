@@ -63,6 +63,26 @@ TEST(stdlib_nullifier_tree, test_kv_memory_vs_memory_consistency)
     EXPECT_EQ(db.root(), memdb.root());
 }
 
+TEST(stdlib_nullifier_tree, test_kv_memory_vs_memory_consistency_poseidon2)
+{
+    constexpr size_t depth = 4;
+    NullifierMemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    MemoryStore store;
+    NullifierTree<MemoryStore, Poseidon2HashPolicy> db(store, depth);
+
+    for (size_t i = 0; i < (1 << depth) - 1; ++i) {
+        memdb.update_element(VALUES[i]);
+        db.update_element(VALUES[i]);
+    }
+
+    for (size_t i = 0; i < (1 << depth); ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+
+    EXPECT_EQ(db.root(), memdb.root());
+}
+
 TEST(stdlib_nullifier_tree, test_size)
 {
     MemoryStore store;
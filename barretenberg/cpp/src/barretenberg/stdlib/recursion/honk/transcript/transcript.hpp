@@ -27,8 +27,10 @@ template <typename Builder> class Transcript {
 
     Transcript() = default;
 
-    Transcript(Builder* builder, auto proof_data)
-        : native_transcript(proof_data)
+    Transcript(Builder* builder,
+               auto proof_data,
+               bb::honk::TranscriptHashType hash_type = bb::honk::TranscriptHashType::PedersenBlake3s)
+        : native_transcript(proof_data, hash_type)
         , builder(builder){};
 
     /**
@@ -28,7 +28,7 @@ std::array<typename Flavor::GroupElement, 2> DeciderRecursiveVerifier_<Flavor>::
     using Instance = typename ::bb::honk::VerifierInstance_<Flavor>;
 
     static constexpr size_t NUM_SUBRELATIONS = Flavor::NUM_SUBRELATIONS;
-    transcript = std::make_shared<Transcript>(builder, proof.proof_data);
+    transcript = std::make_shared<Transcript>(builder, proof.proof_data, Flavor::TRANSCRIPT_HASH_TYPE);
     auto inst = std::make_unique<Instance>();
 
     const auto instance_size = transcript->template receive_from_prover<uint32_t>("instance_size");
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/commitment_schemes/kzg/kzg.hpp"
+#include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
 #include "barretenberg/stdlib/recursion/honk/transcript/transcript.hpp"
@@ -15,6 +16,8 @@ template <typename CircuitBuilder> class MergeRecursiveVerifier_ {
     using OpeningClaim = ::bb::honk::pcs::OpeningClaim<Curve>;
     using PairingPoints = std::array<GroupElement, 2>;
     using Transcript = honk::Transcript<CircuitBuilder>;
+    // Merge proofs are constructed with the GoblinUltra transcript
+    static constexpr auto TRANSCRIPT_HASH_TYPE = ::bb::honk::flavor::GoblinUltra::TRANSCRIPT_HASH_TYPE;
 
     CircuitBuilder* builder;
     std::shared_ptr<Transcript> transcript;
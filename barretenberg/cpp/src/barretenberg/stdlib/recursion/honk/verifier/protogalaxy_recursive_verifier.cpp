@@ -171,7 +171,7 @@ void ProtoGalaxyRecursiveVerifier_<VerifierInstances>::verify_folding_proof(std:
     using AffineElementNative = typename Flavor::Curve::AffineElementNative;
     using ScalarNative = typename Flavor::Curve::ScalarFieldNative;
 
-    transcript = std::make_shared<Transcript>(builder, proof);
+    transcript = std::make_shared<Transcript>(builder, proof, Flavor::TRANSCRIPT_HASH_TYPE);
     prepare_for_folding();
 
     auto delta = transcript->get_challenge("delta");
@@ -30,7 +30,7 @@ std::array<typename Flavor::GroupElement, 2> UltraRecursiveVerifier_<Flavor>::ve
 
     RelationParams relation_parameters;
 
-    transcript = std::make_shared<Transcript>(builder, proof.proof_data);
+    transcript = std::make_shared<Transcript>(builder, proof.proof_data, Flavor::TRANSCRIPT_HASH_TYPE);
 
     VerifierCommitments commitments{ key };
     CommitmentLabels commitment_labels;
@@ -0,0 +1,251 @@
+#include "precomputed_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/polynomials/serialize.hpp"
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <span>
+
+namespace bb::honk {
+
+namespace {
+/**
+ * @brief Reduce a column of circuit data to a 64-bit digest.
+ * @details Uses the xxHash64 round function over 8-byte words followed by its avalanche step. The digest is only used
+ * to key the cache (the per-column digests are combined with sha256), so it is not required to be collision resistant
+ * against adversarially chosen circuits.
+ */
+uint64_t hash_column(std::span<const uint8_t> bytes)
+{
+    constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+
+    uint64_t hash = PRIME_3 + bytes.size();
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= bytes.size(); i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, &bytes[i], sizeof(uint64_t));
+        hash += word * PRIME_2;
+        hash = (hash << 31) | (hash >> 33);
+        hash *= PRIME_1;
+    }
+    for (; i < bytes.size(); ++i) {
+        hash ^= static_cast<uint64_t>(bytes[i]) * PRIME_1;
+        hash = ((hash << 11) | (hash >> 53)) * PRIME_2;
+    }
+    hash ^= hash >> 33;
+    hash *= PRIME_2;
+    hash ^= hash >> 29;
+    hash *= PRIME_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+template <typename Container> std::span<const uint8_t> as_bytes(const Container& container)
+{
+    return { reinterpret_cast<const uint8_t*>(container.data()),
+             container.size() * sizeof(typename Container::value_type) };
+}
+} // namespace
+
+/**
+ * @brief Compute a fingerprint of everything the precomputed polynomials depend on
+ * @details This covers the selectors, the wire copy structure (wire variable indices, real variable indices, tags and
+ * the tag permutation), the public input indices, the lookup tables and the size parameters. Witness values are not
+ * included, so two instances of the same circuit with different witnesses have the same fingerprint. Must be called on
+ * a finalized circuit.
+ *
+ * @param circuit
+ * @param dyadic_circuit_size
+ */
+template <class Flavor>
+typename PrecomputedCache_<Flavor>::Fingerprint PrecomputedCache_<Flavor>::compute_fingerprint(
+    const Circuit& circuit, size_t dyadic_circuit_size)
+{
+    size_t num_ecc_op_gates = 0;
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        num_ecc_op_gates = circuit.num_ecc_op_gates;
+    }
+    const std::vector<uint64_t> size_parameters{ dyadic_circuit_size,
+                                                 circuit.num_gates,
+                                                 circuit.public_inputs.size(),
+                                                 num_ecc_op_gates,
+                                                 circuit.variables.size(),
+                                                 circuit.zero_idx,
+                                                 circuit.lookup_tables.size(),
+                                                 Flavor::NUM_PRECOMPUTED_ENTITIES };
+
+    std::vector<uint32_t> tag_permutation;
+    for (const auto& [tag, permuted_tag] : circuit.tau) {
+        tag_permutation.emplace_back(tag);
+        tag_permutation.emplace_back(permuted_tag);
+    }
+
+    std::vector<uint64_t> table_parameters;
+    for (const auto& table : circuit.lookup_tables) {
+        table_parameters.emplace_back(static_cast<uint64_t>(table.id));
+        table_parameters.emplace_back(table.table_index);
+        table_parameters.emplace_back(table.size);
+        table_parameters.emplace_back(static_cast<uint64_t>(table.use_twin_keys));
+    }
+
+    std::vector<std::span<const uint8_t>> columns{ as_bytes(size_parameters),
+                                                   as_bytes(circuit.public_inputs),
+                                                   as_bytes(circuit.real_variable_index),
+                                                   as_bytes(circuit.real_variable_tags),
+                                                   as_bytes(tag_permutation),
+                                                   as_bytes(table_parameters) };
+    for (const auto& selector : circuit.selectors.get()) {
+        columns.emplace_back(as_bytes(selector));
+    }
+    for (const auto& wire : circuit.wires) {
+        columns.emplace_back(as_bytes(wire));
+    }
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        for (const auto& op_wire : circuit.ecc_op_wires) {
+            columns.emplace_back(as_bytes(op_wire));
+        }
+    }
+    for (const auto& table : circuit.lookup_tables) {
+        columns.emplace_back(as_bytes(table.column_1));
+        columns.emplace_back(as_bytes(table.column_2));
+        columns.emplace_back(as_bytes(table.column_3));
+    }
+
+    std::vector<uint64_t> digests(columns.size());
+    parallel_for(columns.size(), [&](size_t i) { digests[i] = hash_column(columns[i]); });
+
+    std::vector<uint8_t> digest_buffer;
+    for (const auto& digest : digests) {
+        serialize::write(digest_buffer, digest);
+    }
+    return sha256::sha256(digest_buffer);
+}
+
+/**
+ * @brief Look up the precomputed polynomials of a circuit; falls back to the on-disk store (if any) on a memory miss
+ *
+ * @return The cached entry, or nullptr if the circuit is unknown
+ */
+template <class Flavor>
+std::shared_ptr<const typename PrecomputedCache_<Flavor>::Entry> PrecomputedCache_<Flavor>::get(
+    const Fingerprint& fingerprint)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (auto it = entries.find(fingerprint); it != entries.end()) {
+        return it->second;
+    }
+    if (directory.empty()) {
+        return nullptr;
+    }
+    auto entry = read_from_disk(fingerprint);
+    if (entry) {
+        entries[fingerprint] = entry;
+    }
+    return entry;
+}
+
+template <class Flavor>
+void PrecomputedCache_<Flavor>::put(const Fingerprint& fingerprint, std::shared_ptr<const Entry> entry)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!directory.empty()) {
+        write_to_disk(fingerprint, *entry);
+    }
+    entries[fingerprint] = std::move(entry);
+}
+
+template <class Flavor>
+std::shared_ptr<typename Flavor::VerificationKey> PrecomputedCache_<Flavor>::get_verification_key(
+    const Fingerprint& fingerprint)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = verification_keys.find(fingerprint);
+    return it == verification_keys.end() ? nullptr : it->second;
+}
+
+template <class Flavor>
+void PrecomputedCache_<Flavor>::put_verification_key(const Fingerprint& fingerprint,
+                                                     std::shared_ptr<VerificationKey> verification_key)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    verification_keys[fingerprint] = std::move(verification_key);
+}
+
+template <class Flavor> size_t PrecomputedCache_<Flavor>::size() const
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+/**
+ * @brief Drop all in-memory entries. Files in the on-disk store are left untouched.
+ */
+template <class Flavor> void PrecomputedCache_<Flavor>::clear()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    entries.clear();
+    verification_keys.clear();
+}
+
+template <class Flavor> std::string PrecomputedCache_<Flavor>::get_path(const Fingerprint& fingerprint) const
+{
+    std::ostringstream path;
+    path << directory << "/" << fingerprint << ".pk";
+    return path.str();
+}
+
+template <class Flavor>
+std::shared_ptr<const typename PrecomputedCache_<Flavor>::Entry> PrecomputedCache_<Flavor>::read_from_disk(
+    const Fingerprint& fingerprint) const
+{
+    std::ifstream file(get_path(fingerprint), std::ios::binary);
+    if (!file) {
+        return nullptr;
+    }
+    auto entry = std::make_shared<Entry>();
+    uint32_t circuit_size = 0;
+    uint32_t num_public_inputs = 0;
+    uint32_t num_polynomials = 0;
+    serialize::read(file, circuit_size);
+    serialize::read(file, num_public_inputs);
+    serialize::read(file, num_polynomials);
+    if (!file || num_polynomials != Flavor::NUM_PRECOMPUTED_ENTITIES) {
+        return nullptr;
+    }
+    entry->circuit_size = circuit_size;
+    entry->num_public_inputs = num_public_inputs;
+    entry->precomputed_polynomials.resize(num_polynomials);
+    for (auto& polynomial : entry->precomputed_polynomials) {
+        read(static_cast<std::istream&>(file), polynomial);
+        if (!file || polynomial.size() != circuit_size) {
+            return nullptr;
+        }
+    }
+    return entry;
+}
+
+template <class Flavor>
+void PrecomputedCache_<Flavor>::write_to_disk(const Fingerprint& fingerprint, const Entry& entry) const
+{
+    std::ofstream file(get_path(fingerprint), std::ios::binary);
+    if (!file) {
+        info("PrecomputedCache: unable to write ", get_path(fingerprint));
+        return;
+    }
+    serialize::write(file, static_cast<uint32_t>(entry.circuit_size));
+    serialize::write(file, static_cast<uint32_t>(entry.num_public_inputs));
+    serialize::write(file, static_cast<uint32_t>(entry.precomputed_polynomials.size()));
+    for (const auto& polynomial : entry.precomputed_polynomials) {
+        write(file, polynomial);
+    }
+}
+
+template class PrecomputedCache_<honk::flavor::Ultra>;
+template class PrecomputedCache_<honk::flavor::GoblinUltra>;
+
+} // namespace bb::honk
@@ -0,0 +1,74 @@
+#pragma once
+#include "barretenberg/flavor/goblin_ultra.hpp"
+#include "barretenberg/flavor/ultra.hpp"
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace bb::honk {
+/**
+ * @brief Cache of the circuit-independent part of a Honk proving key, keyed by a fingerprint of the circuit structure.
+ * @details When the same circuit is proven repeatedly with different witnesses, the selectors, the sigma/id
+ * permutation polynomials, the lookup table polynomials and the Lagrange polynomials are identical from one proof to
+ * the next; only the wires depend on the witness. A ProverInstance_ given a cache looks its circuit up by fingerprint
+ * and, on a hit, shares the cached precomputed polynomials instead of recomputing them. The verification key is cached
+ * alongside once it has been computed by the composer.
+ *
+ * Note that finalization of range constraints and RAM/ROM arrays orders gates by witness value; circuits using them
+ * have a witness-dependent copy structure and will (correctly) map to different fingerprints for different witnesses.
+ *
+ * If a directory is provided, precomputed polynomials are also persisted there (one file per fingerprint) so that
+ * they survive process restarts. Verification keys are only cached in memory.
+ *
+ * @note Cached polynomials are shared (not copied) between proving keys and must be treated as read-only.
+ */
+template <class Flavor> class PrecomputedCache_ {
+    using Circuit = typename Flavor::CircuitBuilder;
+    using Polynomial = typename Flavor::Polynomial;
+    using VerificationKey = typename Flavor::VerificationKey;
+
+  public:
+    using Fingerprint = std::array<uint8_t, 32>;
+
+    /**
+     * @brief The precomputed polynomials of a proving key, ordered as in ProvingKey::get_precomputed_polynomials()
+     */
+    struct Entry {
+        size_t circuit_size = 0;
+        size_t num_public_inputs = 0;
+        std::vector<Polynomial> precomputed_polynomials;
+    };
+
+    PrecomputedCache_() = default;
+    explicit PrecomputedCache_(std::string directory)
+        : directory(std::move(directory))
+    {}
+
+    static Fingerprint compute_fingerprint(const Circuit& circuit, size_t dyadic_circuit_size);
+
+    std::shared_ptr<const Entry> get(const Fingerprint& fingerprint);
+    void put(const Fingerprint& fingerprint, std::shared_ptr<const Entry> entry);
+
+    std::shared_ptr<VerificationKey> get_verification_key(const Fingerprint& fingerprint);
+    void put_verification_key(const Fingerprint& fingerprint, std::shared_ptr<VerificationKey> verification_key);
+
+    size_t size() const;
+    void clear();
+
+  private:
+    mutable std::mutex mutex;
+    std::map<Fingerprint, std::shared_ptr<const Entry>> entries;
+    std::map<Fingerprint, std::shared_ptr<VerificationKey>> verification_keys;
+    std::string directory;
+
+    std::string get_path(const Fingerprint& fingerprint) const;
+    std::shared_ptr<const Entry> read_from_disk(const Fingerprint& fingerprint) const;
+    void write_to_disk(const Fingerprint& fingerprint, const Entry& entry) const;
+};
+
+using UltraPrecomputedCache = PrecomputedCache_<honk::flavor::Ultra>;
+using GoblinUltraPrecomputedCache = PrecomputedCache_<honk::flavor::GoblinUltra>;
+} // namespace bb::honk
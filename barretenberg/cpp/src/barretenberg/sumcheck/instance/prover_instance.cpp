@@ -203,17 +203,66 @@ void ProverInstance_<Flavor>::construct_databus_polynomials(Circuit& circuit)
     proving_key->calldata_read_counts = calldata_read_counts.share();
 }
 
+/**
+ * @brief Compute the proving key, taking its precomputed polynomials from the cache if the circuit is known to it
+ *
+ * @tparam Flavor
+ * @param circuit
+ * @param precomputed_cache May be null, in which case the precomputed polynomials are always constructed
+ */
 template <class Flavor>
-std::shared_ptr<typename Flavor::ProvingKey> ProverInstance_<Flavor>::compute_proving_key(Circuit& circuit)
+std::shared_ptr<typename Flavor::ProvingKey> ProverInstance_<Flavor>::compute_proving_key(
+    Circuit& circuit, const std::shared_ptr<PrecomputedCache>& precomputed_cache)
 {
     if (proving_key) {
         return proving_key;
     }
 
-    // Compute lagrange selectors
+    if (precomputed_cache) {
+        circuit_fingerprint = PrecomputedCache::compute_fingerprint(circuit, dyadic_circuit_size);
+        if (auto entry = precomputed_cache->get(*circuit_fingerprint)) {
+            proving_key =
+                std::make_shared<ProvingKey>(dyadic_circuit_size, num_public_inputs, entry->precomputed_polynomials);
+            verification_key = precomputed_cache->get_verification_key(*circuit_fingerprint);
+        }
+    }
 
-    proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size, num_public_inputs);
+    if (!proving_key) {
+        proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size, num_public_inputs);
+        construct_precomputed_polynomials(circuit);
 
+        if (precomputed_cache) {
+            auto entry = std::make_shared<typename PrecomputedCache::Entry>();
+            entry->circuit_size = dyadic_circuit_size;
+            entry->num_public_inputs = num_public_inputs;
+            for (auto& poly : proving_key->get_precomputed_polynomials()) {
+                entry->precomputed_polynomials.emplace_back(poly.share());
+            }
+            precomputed_cache->put(*circuit_fingerprint, std::move(entry));
+        }
+    }
+
+    proving_key->recursive_proof_public_input_indices =
+        std::vector<uint32_t>(recursive_proof_public_input_indices.begin(), recursive_proof_public_input_indices.end());
+
+    proving_key->contains_recursive_proof = contains_recursive_proof;
+
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        proving_key->num_ecc_op_gates = num_ecc_op_gates;
+    }
+
+    return proving_key;
+}
+
+/**
+ * @brief Construct the circuit-independent polynomials of the proving key: selectors, sigma/id permutation
+ * polynomials, Lagrange polynomials and lookup table polynomials
+ *
+ * @tparam Flavor
+ * @param circuit
+ */
+template <class Flavor> void ProverInstance_<Flavor>::construct_precomputed_polynomials(Circuit& circuit)
+{
     construct_selector_polynomials<Flavor>(circuit, proving_key.get());
 
     compute_honk_generalized_sigma_permutations<Flavor>(circuit, proving_key.get());
@@ -262,13 +311,7 @@ std::shared_ptr<typename Flavor::ProvingKey> ProverInstance_<Flavor>::compute_pr
     proving_key->table_3 = poly_q_table_column_3.share();
     proving_key->table_4 = poly_q_table_column_4.share();
 
-    proving_key->recursive_proof_public_input_indices =
-        std::vector<uint32_t>(recursive_proof_public_input_indices.begin(), recursive_proof_public_input_indices.end());
-
-    proving_key->contains_recursive_proof = contains_recursive_proof;
-
     if constexpr (IsGoblinFlavor<Flavor>) {
-        proving_key->num_ecc_op_gates = num_ecc_op_gates;
         // Construct simple ID polynomial for databus indexing
         typename Flavor::Polynomial databus_id(proving_key->circuit_size);
         for (size_t i = 0; i < databus_id.size(); ++i) {
@@ -276,8 +319,6 @@ std::shared_ptr<typename Flavor::ProvingKey> ProverInstance_<Flavor>::compute_pr
         }
         proving_key->databus_id = databus_id.share();
     }
-
-    return proving_key;
 }
 
 template <class Flavor> void ProverInstance_<Flavor>::initialize_prover_polynomials()
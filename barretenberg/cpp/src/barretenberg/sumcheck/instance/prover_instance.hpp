@@ -4,6 +4,7 @@
 #include "barretenberg/flavor/ultra.hpp"
 #include "barretenberg/proof_system/composer/composer_lib.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/sumcheck/instance/precomputed_cache.hpp"
 
 namespace bb::honk {
 /**
@@ -27,6 +28,7 @@ template <class Flavor> class ProverInstance_ {
     using WitnessCommitments = typename Flavor::WitnessCommitments;
     using CommitmentLabels = typename Flavor::CommitmentLabels;
     using RelationSeparator = typename Flavor::RelationSeparator;
+    using PrecomputedCache = PrecomputedCache_<Flavor>;
 
   public:
     std::shared_ptr<ProvingKey> proving_key;
@@ -58,10 +60,20 @@ template <class Flavor> class ProverInstance_ {
     size_t instance_size;
     size_t log_instance_size;
 
-    ProverInstance_(Circuit& circuit)
+    // Fingerprint of the circuit structure; only computed when the instance is constructed with a precomputed cache
+    std::optional<typename PrecomputedCache::Fingerprint> circuit_fingerprint;
+
+    /**
+     * @brief Construct an instance from a finalized circuit
+     *
+     * @param circuit
+     * @param precomputed_cache If provided, the precomputed polynomials (and verification key, if known) are taken
+     * from the cache when the circuit has been seen before, and added to it otherwise
+     */
+    ProverInstance_(Circuit& circuit, const std::shared_ptr<PrecomputedCache>& precomputed_cache = nullptr)
     {
         compute_circuit_size_parameters(circuit);
-        compute_proving_key(circuit);
+        compute_proving_key(circuit, precomputed_cache);
         compute_witness(circuit);
     }
 
@@ -91,7 +103,9 @@ template <class Flavor> class ProverInstance_ {
     size_t num_public_inputs = 0;
     size_t num_ecc_op_gates = 0;
 
-    std::shared_ptr<ProvingKey> compute_proving_key(Circuit&);
+    std::shared_ptr<ProvingKey> compute_proving_key(Circuit&, const std::shared_ptr<PrecomputedCache>&);
+
+    void construct_precomputed_polynomials(Circuit&);
 
     void compute_circuit_size_parameters(Circuit&);
 
@@ -3,6 +3,7 @@
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/blake3s/blake3s.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 
 // #define LOG_CHALLENGES
 // #define LOG_INTERACTIONS
@@ -55,6 +56,15 @@ class TranscriptManifest {
     bool operator==(const TranscriptManifest& other) const = default;
 };
 
+/**
+ * @brief The hash from which a transcript derives its challenges
+ * @details PedersenBlake3s pre-hashes the bytes of each round with Pedersen and derives the challenge with Blake3s.
+ * Poseidon2 absorbs each round into a Poseidon2 sponge over the bn254 scalar field, packing the serialization of every
+ * element into 31-byte chunks. Absorbing the bytes rather than the typed values keeps the prover and the verifier in
+ * agreement when they send and receive an element under different types (e.g. AllValues vs std::array).
+ */
+enum class TranscriptHashType { PedersenBlake3s, Poseidon2 };
+
 /**
  * @brief Common transcript class for both parties. Stores the data for the current round, as well as the
  * manifest.
@@ -65,13 +75,20 @@ class BaseTranscript {
 
     BaseTranscript() = default;
 
+    explicit BaseTranscript(TranscriptHashType hash_type)
+        : hash_type(hash_type)
+    {}
+
     /**
      * @brief Construct a new Base Transcript object for Verifier using proof_data
      *
      * @param proof_data
+     * @param hash_type must match the prover's
      */
-    explicit BaseTranscript(const Proof& proof_data)
-        : proof_data(proof_data.begin(), proof_data.end())
+    explicit BaseTranscript(const Proof& proof_data,
+                            TranscriptHashType hash_type = TranscriptHashType::PedersenBlake3s)
+        : hash_type(hash_type)
+        , proof_data(proof_data.begin(), proof_data.end())
     {}
     static constexpr size_t HASH_OUTPUT_SIZE = 32;
 
@@ -81,13 +98,21 @@ class BaseTranscript {
     size_t round_number = 0;      // current round for manifest
 
   private:
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
     static constexpr size_t MIN_BYTES_PER_CHALLENGE = 128 / 8; // 128 bit challenges
+    static constexpr size_t BYTES_PER_ELEMENT = 31;             // bytes packed into a field element by Poseidon2
+    TranscriptHashType hash_type = TranscriptHashType::PedersenBlake3s;
     bool is_first_challenge = true; // indicates if this is the first challenge this transcript is generating
     std::array<uint8_t, HASH_OUTPUT_SIZE> previous_challenge_buffer{}; // default-initialized to zeros
     std::vector<uint8_t> current_round_data;
+    // Poseidon2 counterparts of the two buffers above
+    bb::fr previous_challenge = 0;
+    std::vector<bb::fr> current_round_elements;
 
     // "Manifest" object that records a summary of the transcript interactions
     TranscriptManifest manifest;
+    bool use_manifest = true;
 
     /**
      * @brief Compute next challenge c_next = H( Compress(c_prev || round_buffer) )
@@ -138,6 +163,41 @@ class BaseTranscript {
         return new_challenge_buffer;
     };
 
+    /**
+     * @brief Compute next challenge c_next = Poseidon2(c_prev || round_elements), and return its low 128 bits
+     */
+    [[nodiscard]] uint256_t get_next_poseidon2_challenge()
+    {
+        if (is_first_challenge) {
+            ASSERT(!current_round_elements.empty());
+        }
+
+        std::vector<bb::fr> full_buffer = std::move(current_round_elements);
+        current_round_elements.clear();
+        if (!is_first_challenge) {
+            full_buffer.insert(full_buffer.begin(), previous_challenge);
+        } else {
+            is_first_challenge = false;
+        }
+
+        previous_challenge = Poseidon2::hash(full_buffer);
+        return uint256_t(previous_challenge).slice(0, MIN_BYTES_PER_CHALLENGE * 8);
+    }
+
+    /**
+     * @brief Append the serialization of an element sent by the prover to the Poseidon2 round data
+     */
+    void absorb_prover_element_bytes(std::span<const uint8_t> element_bytes)
+    {
+        for (size_t start = 0; start < element_bytes.size(); start += BYTES_PER_ELEMENT) {
+            uint256_t chunk = 0;
+            for (size_t i = start; i < std::min(start + BYTES_PER_ELEMENT, element_bytes.size()); ++i) {
+                chunk = (chunk << 8) + uint256_t(element_bytes[i]);
+            }
+            current_round_elements.emplace_back(chunk);
+        }
+    }
+
   protected:
     /**
      * @brief Adds challenge elements to the current_round_buffer and updates the manifest.
@@ -148,9 +208,15 @@ class BaseTranscript {
     void consume_prover_element_bytes(const std::string& label, std::span<const uint8_t> element_bytes)
     {
         // Add an entry to the current round of the manifest
-        manifest.add_entry(round_number, label, element_bytes.size());
+        if (use_manifest) {
+            manifest.add_entry(round_number, label, element_bytes.size());
+        }
 
-        current_round_data.insert(current_round_data.end(), element_bytes.begin(), element_bytes.end());
+        if (hash_type == TranscriptHashType::Poseidon2) {
+            absorb_prover_element_bytes(element_bytes);
+        } else {
+            current_round_data.insert(current_round_data.end(), element_bytes.begin(), element_bytes.end());
+        }
 
         num_bytes_written += element_bytes.size();
     }
@@ -228,7 +294,9 @@ class BaseTranscript {
         constexpr size_t num_challenges = sizeof...(Strings);
 
         // Add challenge labels for current round to the manifest
-        manifest.add_challenge(round_number, labels...);
+        if (use_manifest) {
+            manifest.add_challenge(round_number, labels...);
+        }
 
         // Compute the new challenge buffer from which we derive the challenges.
 
@@ -237,6 +305,10 @@ class BaseTranscript {
 
         // Generate the challenges by iteratively hashing over the previous challenge.
         for (size_t i = 0; i < num_challenges; i++) {
+            if (hash_type == TranscriptHashType::Poseidon2) {
+                challenges[i] = get_next_poseidon2_challenge();
+                continue;
+            }
             auto next_challenge_buffer = get_next_challenge_buffer(); // get next challenge buffer
             std::array<uint8_t, sizeof(uint256_t)> field_element_buffer{};
             // copy half of the hash to lower 128 bits of challenge
@@ -347,6 +419,13 @@ class BaseTranscript {
         return result;
     }
 
+    [[nodiscard]] TranscriptHashType get_hash_type() const { return hash_type; }
+
+    /**
+     * @brief Stop recording the manifest, which is only needed to test the structure of a proof
+     */
+    void disable_manifest() { use_manifest = false; }
+
     [[nodiscard]] TranscriptManifest get_manifest() const { return manifest; };
 
     void print() { manifest.print(); }
@@ -47,3 +47,59 @@ TEST(BaseTranscript, TwoProversTwoFields)
     EXPECT_STATE(verifier_transcript, 0, 64, 64);
     EXPECT_EQ(received_b, elt_b);
 }
+
+/**
+ * @brief Test that a Poseidon2 transcript derives the same challenges for the prover and the verifier, and different
+ * ones from a Pedersen/Blake3s transcript
+ *
+ */
+TEST(BaseTranscript, Poseidon2ProverVerifierAgree)
+{
+    const auto send = [](Transcript& transcript) {
+        transcript.send_to_verifier("scalar", Fr(1377));
+        transcript.send_to_verifier("scalars", std::array<Fr, 3>{ 1, 2, 3 });
+        transcript.send_to_verifier("commitment", g1::affine_one);
+        transcript.send_to_verifier("size", static_cast<uint32_t>(1 << 10));
+    };
+    Transcript prover_transcript{ honk::TranscriptHashType::Poseidon2 };
+    send(prover_transcript);
+    auto [alpha, beta] = prover_transcript.get_challenges("alpha", "beta");
+    prover_transcript.send_to_verifier("base_field", Fq(773));
+    auto gamma = prover_transcript.get_challenge("gamma");
+
+    Transcript verifier_transcript{ prover_transcript.proof_data, honk::TranscriptHashType::Poseidon2 };
+    EXPECT_EQ(verifier_transcript.receive_from_prover<Fr>("scalar"), Fr(1377));
+    verifier_transcript.receive_from_prover<std::array<Fr, 3>>("scalars");
+    EXPECT_EQ(verifier_transcript.receive_from_prover<g1::affine_element>("commitment"), g1::affine_one);
+    verifier_transcript.receive_from_prover<uint32_t>("size");
+    EXPECT_EQ(verifier_transcript.get_challenges("alpha", "beta"), (std::array<uint256_t, 2>{ alpha, beta }));
+    verifier_transcript.receive_from_prover<Fq>("base_field");
+    EXPECT_EQ(verifier_transcript.get_challenge("gamma"), gamma);
+    EXPECT_EQ(verifier_transcript.get_manifest(), prover_transcript.get_manifest());
+
+    // Challenges are 128 bits, and distinct from those of the default hash
+    EXPECT_LT(alpha.get_msb(), 128UL);
+    EXPECT_NE(alpha, beta);
+    Transcript pedersen_transcript;
+    send(pedersen_transcript);
+    EXPECT_NE(pedersen_transcript.get_challenge("alpha"), alpha);
+}
+
+/**
+ * @brief Test that disabling the manifest only stops recording it
+ *
+ */
+TEST(BaseTranscript, ManifestFree)
+{
+    Transcript transcript{ honk::TranscriptHashType::Poseidon2 };
+    Transcript manifest_free_transcript{ honk::TranscriptHashType::Poseidon2 };
+    manifest_free_transcript.disable_manifest();
+    for (auto* t : { &transcript, &manifest_free_transcript }) {
+        t->send_to_verifier("a", Fr(1));
+        t->send_to_verifier("b", Fr(2));
+    }
+    EXPECT_EQ(manifest_free_transcript.get_challenge("c"), transcript.get_challenge("c"));
+    EXPECT_EQ(manifest_free_transcript.proof_data, transcript.proof_data);
+    EXPECT_EQ(transcript.get_manifest().size(), 1UL);
+    EXPECT_EQ(manifest_free_transcript.get_manifest().size(), 0UL);
+}
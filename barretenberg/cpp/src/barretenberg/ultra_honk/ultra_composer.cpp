@@ -69,10 +69,15 @@ std::shared_ptr<ProverInstance_<Flavor>> UltraComposer_<Flavor>::create_instance
 {
     circuit.add_gates_to_ensure_all_polys_are_non_zero();
     circuit.finalize_circuit();
-    auto instance = std::make_shared<Instance>(circuit);
+    auto instance = std::make_shared<Instance>(circuit, precomputed_cache);
     commitment_key = compute_commitment_key(instance->proving_key->circuit_size);
 
-    compute_verification_key(instance);
+    if (!instance->verification_key) {
+        compute_verification_key(instance);
+        if (precomputed_cache) {
+            precomputed_cache->put_verification_key(*instance->circuit_fingerprint, instance->verification_key);
+        }
+    }
     return instance;
 }
 
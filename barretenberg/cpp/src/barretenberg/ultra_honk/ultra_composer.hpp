@@ -26,6 +26,7 @@ template <UltraFlavor Flavor> class UltraComposer_ {
     using FF = typename Flavor::FF;
     using Transcript = typename Flavor::Transcript;
     using CRSFactory = srs::factories::CrsFactory<typename Flavor::Curve>;
+    using PrecomputedCache = PrecomputedCache_<Flavor>;
 
     static constexpr size_t NUM_FOLDING = 2;
     using ProverInstances = ProverInstances_<Flavor, NUM_FOLDING>;
@@ -40,6 +41,8 @@ template <UltraFlavor Flavor> class UltraComposer_ {
     std::shared_ptr<CRSFactory> crs_factory_;
     // The commitment key is passed to the prover but also used herein to compute the verfication key commitments
     std::shared_ptr<CommitmentKey> commitment_key;
+    // Optional cache of precomputed polynomials and verification keys shared across instances of the same circuit
+    std::shared_ptr<PrecomputedCache> precomputed_cache;
 
     UltraComposer_() { crs_factory_ = bb::srs::get_crs_factory(); }
 
@@ -47,6 +50,11 @@ template <UltraFlavor Flavor> class UltraComposer_ {
         : crs_factory_(std::move(crs_factory))
     {}
 
+    explicit UltraComposer_(std::shared_ptr<PrecomputedCache> precomputed_cache)
+        : crs_factory_(bb::srs::get_crs_factory())
+        , precomputed_cache(std::move(precomputed_cache))
+    {}
+
     UltraComposer_(UltraComposer_&& other) noexcept = default;
     UltraComposer_(UltraComposer_ const& other) noexcept = default;
     UltraComposer_& operator=(UltraComposer_&& other) noexcept = default;
@@ -12,6 +12,7 @@
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <string>
 #include <vector>
@@ -886,4 +887,103 @@ TEST_F(UltraHonkComposerTests, range_constraint_small_variable)
 
     auto composer = UltraComposer();
     prove_and_verify(circuit_builder, composer, /*expected_result=*/true);
-}
\ No newline at end of file
+}
+/**
+ * @brief Build the same circuit (public inputs, arithmetic gates, copy constraints and lookups) for a given witness
+ */
+UltraCircuitBuilder construct_circuit_with_witness(uint32_t seed)
+{
+    auto builder = UltraCircuitBuilder();
+    for (size_t i = 0; i < 8; ++i) {
+        fr a = fr(seed + i);
+        fr b = fr(seed * 3 + i);
+        uint32_t a_idx = builder.add_public_variable(a);
+        uint32_t b_idx = builder.add_variable(b);
+        uint32_t c_idx = builder.add_variable(a + b);
+        uint32_t d_idx = builder.add_variable(a * b);
+        builder.create_big_add_gate({ a_idx, b_idx, c_idx, builder.zero_idx, fr(1), fr(1), fr(-1), fr(0), fr(0) });
+        builder.create_mul_gate({ a_idx, b_idx, d_idx, fr(1), fr(-1), fr(0) });
+    }
+
+    fr left = fr{ seed, 0, 0, 0 }.to_montgomery_form();
+    fr right = fr{ seed ^ 0xdeadbeef, 0, 0, 0 }.to_montgomery_form();
+    uint32_t left_idx = builder.add_variable(left);
+    uint32_t right_idx = builder.add_variable(right);
+    const auto lookup_accumulators =
+        plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_XOR, left, right, true);
+    builder.create_gates_from_plookup_accumulators(
+        plookup::MultiTableId::UINT32_XOR, lookup_accumulators, left_idx, right_idx);
+    return builder;
+}
+
+/**
+ * @brief Instances of the same circuit with different witnesses share the precomputed polynomials and verification key
+ * held by the cache, and the resulting proofs verify
+ */
+TEST_F(UltraHonkComposerTests, PrecomputedCacheReuse)
+{
+    auto cache = std::make_shared<UltraPrecomputedCache>();
+    auto composer = UltraComposer(cache);
+
+    auto first_builder = construct_circuit_with_witness(5);
+    auto first_instance = composer.create_instance(first_builder);
+    EXPECT_EQ(cache->size(), 1);
+
+    auto second_builder = construct_circuit_with_witness(17);
+    auto second_instance = composer.create_instance(second_builder);
+    EXPECT_EQ(cache->size(), 1);
+    EXPECT_EQ(first_instance->circuit_fingerprint, second_instance->circuit_fingerprint);
+    EXPECT_EQ(first_instance->verification_key, second_instance->verification_key);
+
+    for (auto [first_poly, second_poly] : zip_view(first_instance->proving_key->get_precomputed_polynomials(),
+                                                   second_instance->proving_key->get_precomputed_polynomials())) {
+        EXPECT_EQ(first_poly.data(), second_poly.data());
+    }
+    EXPECT_NE(first_instance->proving_key->w_l, second_instance->proving_key->w_l);
+
+    // The cached polynomials match those computed without a cache
+    auto uncached_builder = construct_circuit_with_witness(17);
+    auto uncached_composer = UltraComposer();
+    auto uncached_instance = uncached_composer.create_instance(uncached_builder);
+    for (auto [cached_poly, uncached_poly] : zip_view(second_instance->proving_key->get_precomputed_polynomials(),
+                                                      uncached_instance->proving_key->get_precomputed_polynomials())) {
+        EXPECT_EQ(cached_poly, uncached_poly);
+    }
+
+    for (auto& instance : { first_instance, second_instance }) {
+        auto prover = composer.create_prover(instance);
+        auto verifier = composer.create_verifier(instance);
+        auto proof = prover.construct_proof();
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+}
+
+/**
+ * @brief Precomputed polynomials written by one cache are picked up from disk by a fresh cache
+ */
+TEST_F(UltraHonkComposerTests, PrecomputedCacheOnDisk)
+{
+    auto directory = std::filesystem::temp_directory_path() / "bb_precomputed_cache_test";
+    std::filesystem::create_directories(directory);
+
+    auto first_builder = construct_circuit_with_witness(3);
+    auto first_composer = UltraComposer(std::make_shared<UltraPrecomputedCache>(directory.string()));
+    auto first_instance = first_composer.create_instance(first_builder);
+
+    auto cache = std::make_shared<UltraPrecomputedCache>(directory.string());
+    auto composer = UltraComposer(cache);
+    auto builder = construct_circuit_with_witness(11);
+    auto instance = composer.create_instance(builder);
+    EXPECT_EQ(cache->size(), 1);
+    for (auto [first_poly, poly] : zip_view(first_instance->proving_key->get_precomputed_polynomials(),
+                                            instance->proving_key->get_precomputed_polynomials())) {
+        EXPECT_EQ(first_poly, poly);
+    }
+
+    auto prover = composer.create_prover(instance);
+    auto verifier = composer.create_verifier(instance);
+    auto proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    std::filesystem::remove_all(directory);
+}
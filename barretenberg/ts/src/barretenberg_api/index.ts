@@ -51,6 +51,54 @@ export class BarretenbergApi {
     return out[0];
   }
 
+  async pedersenHashBatch(inputsBuffer: Fr[], hashSize: number, hashIndex: number): Promise<Fr[]> {
+    const inArgs = [inputsBuffer, hashSize, hashIndex].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = await this.wasm.callWasmExport(
+      'pedersen_hash_batch',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
+  async pedersenHashPairs(inputsBuffer: Fr[], hashIndex: number): Promise<Fr[]> {
+    const inArgs = [inputsBuffer, hashIndex].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = await this.wasm.callWasmExport(
+      'pedersen_hash_pairs',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
+  async poseidon2Hash(inputsBuffer: Fr[]): Promise<Fr> {
+    const inArgs = [inputsBuffer].map(serializeBufferable);
+    const outTypes: OutputType[] = [Fr];
+    const result = await this.wasm.callWasmExport(
+      'poseidon2_hash',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
+  async poseidon2HashBatch(inputsBuffer: Fr[], hashSize: number): Promise<Fr[]> {
+    const inArgs = [inputsBuffer, hashSize].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = await this.wasm.callWasmExport(
+      'poseidon2_hash_batch',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   async blake2s(data: Uint8Array): Promise<Buffer32> {
     const inArgs = [data].map(serializeBufferable);
     const outTypes: OutputType[] = [Buffer32];
@@ -123,6 +171,23 @@ export class BarretenbergApi {
     return out[0];
   }
 
+  async schnorrVerifySignaturesBatch(
+    messages: Uint8Array[],
+    pubKeys: Point[],
+    sigsS: Buffer32[],
+    sigsE: Buffer32[],
+  ): Promise<Buffer> {
+    const inArgs = [messages, pubKeys, sigsS, sigsE].map(serializeBufferable);
+    const outTypes: OutputType[] = [BufferDeserializer()];
+    const result = await this.wasm.callWasmExport(
+      'schnorr_verify_signatures_batch',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   async schnorrMultisigCreateMultisigPublicKey(privateKey: Fq): Promise<Buffer128> {
     const inArgs = [privateKey].map(serializeBufferable);
     const outTypes: OutputType[] = [Buffer128];
@@ -564,6 +629,54 @@ export class BarretenbergApiSync {
     return out[0];
   }
 
+  pedersenHashBatch(inputsBuffer: Fr[], hashSize: number, hashIndex: number): Fr[] {
+    const inArgs = [inputsBuffer, hashSize, hashIndex].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = this.wasm.callWasmExport(
+      'pedersen_hash_batch',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
+  pedersenHashPairs(inputsBuffer: Fr[], hashIndex: number): Fr[] {
+    const inArgs = [inputsBuffer, hashIndex].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = this.wasm.callWasmExport(
+      'pedersen_hash_pairs',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
+  poseidon2Hash(inputsBuffer: Fr[]): Fr {
+    const inArgs = [inputsBuffer].map(serializeBufferable);
+    const outTypes: OutputType[] = [Fr];
+    const result = this.wasm.callWasmExport(
+      'poseidon2_hash',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
+  poseidon2HashBatch(inputsBuffer: Fr[], hashSize: number): Fr[] {
+    const inArgs = [inputsBuffer, hashSize].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = this.wasm.callWasmExport(
+      'poseidon2_hash_batch',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   blake2s(data: Uint8Array): Buffer32 {
     const inArgs = [data].map(serializeBufferable);
     const outTypes: OutputType[] = [Buffer32];
@@ -636,6 +749,23 @@ export class BarretenbergApiSync {
     return out[0];
   }
 
+  schnorrVerifySignaturesBatch(
+    messages: Uint8Array[],
+    pubKeys: Point[],
+    sigsS: Buffer32[],
+    sigsE: Buffer32[],
+  ): Buffer {
+    const inArgs = [messages, pubKeys, sigsS, sigsE].map(serializeBufferable);
+    const outTypes: OutputType[] = [BufferDeserializer()];
+    const result = this.wasm.callWasmExport(
+      'schnorr_verify_signatures_batch',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   schnorrMultisigCreateMultisigPublicKey(privateKey: Fq): Buffer128 {
     const inArgs = [privateKey].map(serializeBufferable);
     const outTypes: OutputType[] = [Buffer128];